@@ -0,0 +1,261 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "sys/tools/compiler.hpp"
+
+namespace compilers
+{
+/**
+ * @brief A compiler that produces nothing, only waiting for the configured amount of time
+ * 
+ */
+class DelayedCompiler : public ::sys::tools::Compiler
+{
+	using Clock = std::chrono::steady_clock;
+
+public:
+	/**
+	 * @brief The distribution of the delays
+	 * 
+	 */
+	enum class Distribution
+	{
+		kConstant,
+		kUniform,
+		kExponential
+	};
+
+	/**
+	 * @brief The record about a single compilation
+	 * 
+	 */
+	struct Record
+	{
+		/**
+		 * @brief The thread, that has run the compilation
+		 * 
+		 */
+		std::thread::id thread;
+
+		/**
+		 * @brief The moment the compilation has started
+		 * 
+		 */
+		Clock::time_point start;
+
+		/**
+		 * @brief The moment the compilation has finished
+		 * 
+		 */
+		Clock::time_point end;
+	};
+
+	/**
+	 * @brief The records, shared by all the instances created for a single run
+	 * 
+	 */
+	struct Records
+	{
+		/**
+		 * @brief Construct a new Records object
+		 * 
+		 * @param capacity - the maximum number of compilations
+		 */
+		explicit Records(std::size_t capacity)
+			: values(capacity)
+		{}
+
+		/**
+		 * @brief The records, filled in the order the compilations were started
+		 * 
+		 */
+		std::vector<Record> values;
+
+		/**
+		 * @brief The index of the next record to fill
+		 * 
+		 */
+		std::atomic<std::size_t> next{0};
+	};
+
+public:
+	/**
+	 * @brief Construct a new DelayedCompiler object
+	 * 
+	 * @param records - the storage for the records about the compilations
+	 * @param delay - the mean delay of a compilation
+	 * @param distribution - the distribution of the delays
+	 */
+	DelayedCompiler(std::shared_ptr<Records> records,
+					std::chrono::microseconds delay,
+					Distribution distribution)
+		: records_{std::move(records)}
+		, delay_{delay}
+		, distribution_{distribution}
+	{}
+
+public:
+	/**
+	 * @brief Pretend to compile the given file
+	 * 
+	 */
+	void Compile(const std::filesystem::path&, const std::filesystem::path&, const sys::Command::Listener&) override
+	{
+		Wait();
+	}
+
+	/**
+	 * @brief Pretend to compile the given unit of a module
+	 * 
+	 */
+	void CompileModule(const std::filesystem::path&, const std::filesystem::path&,
+					   const sys::Command::Listener&) override
+	{
+		Wait();
+	}
+
+	/**
+	 * @brief Pretend to precompile the given header
+	 * 
+	 */
+	void Precompile(const std::filesystem::path&, const std::filesystem::path&, const sys::Command::Listener&) override
+	{}
+
+	/**
+	 * @brief Ignore the precompiled header, nothing is compiled anyway
+	 * 
+	 */
+	void SetPrecompiledHeader(const std::filesystem::path&) override {}
+
+	/**
+	 * @brief Ignore the mapper of the modules, nothing is compiled anyway
+	 * 
+	 */
+	void SetModuleMapper(const std::filesystem::path&) override {}
+
+	/**
+	 * @brief Get the dependencies of the file
+	 * 
+	 * @return std::vector<std::filesystem::path> - no dependencies at all
+	 */
+	std::vector<std::filesystem::path>
+	GetDependencies(const std::filesystem::path&, const sys::Command::Listener&) const override
+	{
+		return {};
+	}
+
+	/**
+	 * @brief Pretend to preprocess the given file
+	 * 
+	 * @return std::string - nothing at all
+	 */
+	std::string Preprocess(const std::filesystem::path&, const sys::Command::Listener&) const override
+	{
+		return {};
+	}
+
+	/**
+	 * @brief Pretend to link the given object files
+	 * 
+	 * @return true always
+	 */
+	bool Link(const std::vector<std::filesystem::path>&, const std::filesystem::path&,
+			  const sys::Command::Listener&) override
+	{
+		return true;
+	}
+
+protected:
+	/**
+	 * @brief Get the delay for the next compilation
+	 * 
+	 * @return std::chrono::microseconds - the delay
+	 */
+	std::chrono::microseconds GetDelay() const
+	{
+		if(!delay_.count())
+		{
+			return delay_;
+		}
+
+		thread_local std::mt19937 generator{std::random_device{}()};
+		const auto mean = static_cast<double>(delay_.count());
+		switch(distribution_)
+		{
+		case Distribution::kUniform:
+			return std::chrono::microseconds{static_cast<std::int64_t>(
+				std::uniform_real_distribution<double>{0.0, 2.0 * mean}(generator))};
+		case Distribution::kExponential:
+			return std::chrono::microseconds{static_cast<std::int64_t>(
+				std::exponential_distribution<double>{1.0 / mean}(generator))};
+		default:
+			return delay_;
+		}
+	}
+
+	/**
+	 * @brief Wait for the delay of a compilation and record it
+	 * 
+	 */
+	void Wait()
+	{
+		const auto start = Clock::now();
+
+		const auto delay = GetDelay();
+		if(delay.count())
+		{
+			std::this_thread::sleep_for(delay);
+		}
+
+		const auto index = records_->next.fetch_add(1, std::memory_order_relaxed);
+		if(index < records_->values.size())
+		{
+			records_->values[index] = {std::this_thread::get_id(), start, Clock::now()};
+		}
+	}
+
+protected:
+	/**
+	 * @brief The storage for the records about the compilations
+	 * 
+	 */
+	std::shared_ptr<Records> records_;
+
+	/**
+	 * @brief The mean delay of a compilation
+	 * 
+	 */
+	const std::chrono::microseconds delay_;
+
+	/**
+	 * @brief The distribution of the delays
+	 * 
+	 */
+	const Distribution distribution_;
+};
+} // namespace compilers
@@ -0,0 +1,182 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "auxillary/generator.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+namespace auxillary
+{
+namespace constants
+{
+constexpr std::size_t kAlphabetSize = 26;
+constexpr std::size_t kNameLength = 4;
+} // namespace constants
+
+Generator::Generator(Options options)
+	: options_{std::move(options)}
+{}
+
+void Generator::Generate(const std::filesystem::path& root)
+{
+	names_.clear();
+	std::filesystem::create_directories(root);
+	GenerateProject(root, 0);
+
+	// The first chain of the top-level project is included by every unit using it
+	deepest_header_.clear();
+	if(options_.headers)
+	{
+		const auto depth = std::max<std::size_t>(options_.depth, 1);
+		deepest_header_ = root / "include" /
+						  ("h" + GetName(std::min(depth, options_.headers) - 1) + ".hpp");
+	}
+}
+
+const std::vector<std::string>& Generator::GetProjectNames() const
+{
+	return names_;
+}
+
+const std::filesystem::path& Generator::GetDeepestHeader() const
+{
+	return deepest_header_;
+}
+
+std::string Generator::GetName(std::size_t index)
+{
+	std::string name(constants::kNameLength, 'a');
+	for(auto it = name.rbegin(); it != name.rend() && index; ++it)
+	{
+		*it = static_cast<char>('a' + index % constants::kAlphabetSize);
+		index /= constants::kAlphabetSize;
+	}
+
+	// Prepend the rest of the index, if it doesn't fit into the default length
+	while(index)
+	{
+		name.insert(name.begin(), static_cast<char>('a' + index % constants::kAlphabetSize));
+		index /= constants::kAlphabetSize;
+	}
+
+	return name;
+}
+
+void Generator::WriteBuildFile(std::ostream& stream, const Project& project)
+{
+	stream << "# Generated by the benchmark suite\n";
+	stream << "!prj \"" << project.name << "\"\n";
+	stream << "!let src = \"src\"\n";
+
+	// Pad the build file with variables nobody uses
+	for(std::size_t i = 0; i < project.variables; ++i)
+	{
+		stream << "!let v" << GetName(i) << " = \"$src/v" << GetName(i) << "\"\n";
+	}
+
+	const auto write_array = [&stream](const std::string& keyword,
+									   const std::vector<std::string>& values,
+									   const std::string& prefix) {
+		stream << "!" << keyword << " [";
+		for(std::size_t i = 0; i < values.size(); ++i)
+		{
+			stream << (i ? ",\n  \"" : "\"") << prefix << values[i] << "\"";
+		}
+		stream << "]\n";
+	};
+
+	if(!project.dependencies.empty())
+	{
+		write_array("deps", project.dependencies, "");
+	}
+
+	if(!project.include_directories.empty())
+	{
+		write_array("inc", project.include_directories, "");
+	}
+
+	write_array("files", project.files, "$src/");
+}
+
+void Generator::GenerateProject(const std::filesystem::path& folder, std::size_t index)
+{
+	const auto name = "p" + GetName(index);
+	names_.push_back(name);
+
+	Project project{name, {}, {}, {"include"}, options_.variables};
+
+	// Add the children of the project in the tree
+	for(std::size_t i = 1; i <= options_.fanout; ++i)
+	{
+		const auto child = index * options_.fanout + i;
+		if(child >= options_.projects)
+		{
+			break;
+		}
+
+		const auto dependency = "d" + GetName(child);
+		project.dependencies.push_back(dependency);
+		GenerateProject(folder / dependency, child);
+	}
+
+	// Generate the headers, each including the next one in it's chain
+	const auto depth = std::max<std::size_t>(options_.depth, 1);
+	std::filesystem::create_directories(folder / "include");
+	for(std::size_t i = 0; i < options_.headers; ++i)
+	{
+		std::ofstream header{folder / "include" / ("h" + GetName(i) + ".hpp")};
+		header << "#pragma once\n\n";
+		if((i + 1) % depth && i + 1 < options_.headers)
+		{
+			header << "#include \"h" << GetName(i + 1) << ".hpp\"\n";
+		}
+		else
+		{
+			header << "#include <string>\n#include <vector>\n";
+		}
+		header << "\ninline int h" << GetName(i) << "() { return " << i << "; }\n";
+	}
+
+	// Generate the translation units, each including the head of a chain
+	const auto chains = options_.headers ? (options_.headers + depth - 1) / depth : 0;
+	std::filesystem::create_directories(folder / "src");
+	for(std::size_t i = 0; i < options_.units; ++i)
+	{
+		const auto file = "u" + GetName(i) + ".cpp";
+		project.files.push_back(file);
+
+		std::ofstream unit{folder / "src" / file};
+		if(chains)
+		{
+			unit << "#include \"h" << GetName(i % chains * depth) << ".hpp\"\n\n";
+		}
+		unit << "int u" << GetName(i) << "() { return " << i << "; }\n";
+
+		// Every project is linked into an executable
+		if(!i)
+		{
+			unit << "\nint main() { return 0; }\n";
+		}
+	}
+
+	std::ofstream build_file{folder / "build.bbs"};
+	WriteBuildFile(build_file, project);
+}
+} // namespace auxillary
@@ -0,0 +1,194 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace auxillary
+{
+/**
+ * @brief The class is used to generate synthetic projects for the benchmarks
+ * 
+ */
+class Generator
+{
+public:
+	/**
+	 * @brief The shape of the generated project tree
+	 * 
+	 */
+	struct Options
+	{
+		/**
+		 * @brief The number of projects in the tree
+		 * 
+		 */
+		std::size_t projects{1};
+
+		/**
+		 * @brief The number of dependencies each project has (until the tree is complete)
+		 * 
+		 */
+		std::size_t fanout{0};
+
+		/**
+		 * @brief The number of translation units in each project
+		 * 
+		 */
+		std::size_t units{100};
+
+		/**
+		 * @brief The number of headers in each project
+		 * 
+		 */
+		std::size_t headers{20};
+
+		/**
+		 * @brief The length of the chains of headers including each other
+		 * 
+		 */
+		std::size_t depth{4};
+
+		/**
+		 * @brief The number of additional variables declared in each build file
+		 * 
+		 */
+		std::size_t variables{0};
+	};
+
+	/**
+	 * @brief The description of a single build file
+	 * 
+	 */
+	struct Project
+	{
+		/**
+		 * @brief The name of the project
+		 * 
+		 */
+		std::string name;
+
+		/**
+		 * @brief The paths to the dependencies, relative to the project
+		 * 
+		 */
+		std::vector<std::string> dependencies;
+
+		/**
+		 * @brief The translation units, relative to the "src" variable
+		 * 
+		 */
+		std::vector<std::string> files;
+
+		/**
+		 * @brief The include directories, relative to the project
+		 * 
+		 */
+		std::vector<std::string> include_directories;
+
+		/**
+		 * @brief The number of additional variables to declare
+		 * 
+		 */
+		std::size_t variables{0};
+	};
+
+public:
+	/**
+	 * @brief Construct a new Generator object
+	 * 
+	 * @param options - the shape of the project tree
+	 */
+	explicit Generator(Options options);
+
+public:
+	/**
+	 * @brief Generate the project tree
+	 * 
+	 * @param root - the folder of the top-level project
+	 */
+	void Generate(const std::filesystem::path& root);
+
+	/**
+	 * @brief Get the names of all the generated projects
+	 * 
+	 * @return const std::vector<std::string>& - the names of the projects
+	 */
+	const std::vector<std::string>& GetProjectNames() const;
+
+	/**
+	 * @brief Get the header at the bottom of the first include chain of the top-level project
+	 * 
+	 * @return const std::filesystem::path& - the path to the header, empty if the projects have no headers
+	 */
+	const std::filesystem::path& GetDeepestHeader() const;
+
+public:
+	/**
+	 * @brief Get an identifier for the given index
+	 * 
+	 * @note The lexer only accepts alphabetical words, so the indices are written in base 26
+	 * 
+	 * @param index - the index to convert
+	 * @return std::string - the identifier, consisting of lowercase letters only
+	 */
+	static std::string GetName(std::size_t index);
+
+	/**
+	 * @brief Write the build file of the given project
+	 * 
+	 * @param stream - the stream to write the build file into
+	 * @param project - the description of the project
+	 */
+	static void WriteBuildFile(std::ostream& stream, const Project& project);
+
+protected:
+	/**
+	 * @brief Generate a single project and it's dependencies
+	 * 
+	 * @param folder - the folder of the project
+	 * @param index - the index of the project in the tree
+	 */
+	void GenerateProject(const std::filesystem::path& folder, std::size_t index);
+
+protected:
+	/**
+	 * @brief The shape of the project tree
+	 * 
+	 */
+	const Options options_;
+
+	/**
+	 * @brief The names of the generated projects
+	 * 
+	 */
+	std::vector<std::string> names_;
+
+	/**
+	 * @brief The header to touch to invalidate a part of the top-level project
+	 * 
+	 */
+	std::filesystem::path deepest_header_;
+};
+} // namespace auxillary
@@ -0,0 +1,272 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "auxillary/generator.hpp"
+#include "sys/nix/command.hpp"
+
+namespace fs = std::filesystem;
+
+static const std::string help{
+	"Usage: endtoend [OPTION]...\n"
+	"Generates a synthetic project tree and measures full, null and incremental builds\n\n"
+	"  --bbs=PATH          the application to benchmark\n"
+	"  --directory=PATH    the folder to generate the projects in\n"
+	"  --projects=N        the number of projects in the tree (default: 1)\n"
+	"  --fanout=N          the number of dependencies of each project (default: 0)\n"
+	"  --units=N           the number of translation units per project (default: 100)\n"
+	"  --headers=N         the number of headers per project (default: 20)\n"
+	"  --depth=N           the length of the header include chains (default: 4)\n"
+	"  --variables=N       the number of extra variables per build file (default: 0)\n"
+	"  --repetitions=N     the number of times to run every scenario (default: 3)\n"
+	"  --output=FILE       the file to write the JSON results into (default: stdout)\n"};
+
+/**
+ * @brief The result of a single build
+ * 
+ */
+struct Sample
+{
+	/**
+	 * @brief The name of the scenario
+	 * 
+	 */
+	std::string scenario;
+
+	/**
+	 * @brief Whether the build has succeeded
+	 * 
+	 */
+	bool success;
+
+	/**
+	 * @brief The wall-clock time of the build
+	 * 
+	 */
+	std::chrono::microseconds wall_time;
+
+	/**
+	 * @brief The resources consumed by the build
+	 * 
+	 */
+	sys::Usage usage;
+};
+
+/**
+ * @brief Quote the given string for the shell
+ * 
+ * @param value - the string to quote
+ * @return std::string - the quoted string
+ */
+static std::string Quote(const std::string& value)
+{
+	std::string result{"'"};
+	for(const auto character : value)
+	{
+		result += character == '\'' ? std::string{"'\\''"} : std::string(1, character);
+	}
+	return result + "'";
+}
+
+/**
+ * @brief Run the application on the top-level project
+ * 
+ * @param bbs - the application to run
+ * @param root - the top-level project
+ * @param scenario - the name of the scenario
+ * @return Sample - the measured result
+ */
+static Sample Build(const fs::path& bbs, const fs::path& root, const std::string& scenario)
+{
+	sys::nix::Command command{"cd " + Quote(root.string()) + " && " + Quote(bbs.string()), "."};
+
+	const auto start = std::chrono::steady_clock::now();
+	const auto success = command.Execute();
+	const auto end = std::chrono::steady_clock::now();
+
+	// The application reports failures on the standard output
+	return {scenario,
+			success && command.GetOutput().empty(),
+			std::chrono::duration_cast<std::chrono::microseconds>(end - start),
+			command.GetUsage()};
+}
+
+/**
+ * @brief Convert the given duration to milliseconds
+ * 
+ * @param value - the value to convert
+ * @return double - the number of milliseconds
+ */
+static double ToMilliseconds(std::chrono::microseconds value)
+{
+	return static_cast<double>(value.count()) / 1000.0;
+}
+
+/**
+ * @brief Write the results in the JSON format
+ * 
+ * @param stream - the stream to write the results into
+ * @param options - the shape of the project tree
+ * @param samples - the measured results
+ */
+static void WriteResults(std::ostream& stream,
+						 const auxillary::Generator::Options& options,
+						 const std::vector<Sample>& samples)
+{
+	stream << "{\n  \"options\": {";
+	stream << "\"projects\": " << options.projects << ", \"fanout\": " << options.fanout
+		   << ", \"units\": " << options.units << ", \"headers\": " << options.headers
+		   << ", \"depth\": " << options.depth << ", \"variables\": " << options.variables
+		   << "},\n";
+
+	stream << "  \"samples\": [";
+	std::map<std::string, std::vector<double>> times{};
+	for(std::size_t i = 0; i < samples.size(); ++i)
+	{
+		const auto& sample = samples[i];
+		stream << (i ? ",\n    " : "\n    ") << "{\"scenario\": \"" << sample.scenario
+			   << "\", \"success\": " << (sample.success ? "true" : "false")
+			   << ", \"wall_ms\": " << ToMilliseconds(sample.wall_time)
+			   << ", \"user_ms\": " << ToMilliseconds(sample.usage.user_time)
+			   << ", \"system_ms\": " << ToMilliseconds(sample.usage.system_time)
+			   << ", \"max_rss_kb\": " << sample.usage.max_resident_set_size
+			   << ", \"voluntary_context_switches\": " << sample.usage.voluntary_context_switches
+			   << ", \"involuntary_context_switches\": "
+			   << sample.usage.involuntary_context_switches << "}";
+
+		times[sample.scenario].push_back(ToMilliseconds(sample.wall_time));
+	}
+	stream << "\n  ],\n";
+
+	stream << "  \"summary\": {";
+	bool first = true;
+	for(auto& [scenario, values] : times)
+	{
+		std::sort(values.begin(), values.end());
+		stream << (first ? "\n    " : ",\n    ") << "\"" << scenario
+			   << "\": {\"min_ms\": " << values.front()
+			   << ", \"median_ms\": " << values[values.size() / 2]
+			   << ", \"max_ms\": " << values.back() << "}";
+		first = false;
+	}
+	stream << "\n  }\n}\n";
+}
+
+int main(int argc, char** argv)
+{
+	auxillary::Generator::Options options{};
+	fs::path bbs{BBS_EXECUTABLE};
+	fs::path directory{fs::temp_directory_path() / "bbs-endtoend"};
+	fs::path output{};
+	std::size_t repetitions{3};
+
+	const std::map<std::string, std::size_t*> numbers{{"--projects", &options.projects},
+													  {"--fanout", &options.fanout},
+													  {"--units", &options.units},
+													  {"--headers", &options.headers},
+													  {"--depth", &options.depth},
+													  {"--variables", &options.variables},
+													  {"--repetitions", &repetitions}};
+
+	// Parse the command line
+	for(int i = 1; i < argc; ++i)
+	{
+		const std::string argument{argv[i]};
+		const auto separator = argument.find('=');
+		const auto key = argument.substr(0, separator);
+		const auto value = separator == std::string::npos ? "" : argument.substr(separator + 1);
+
+		if(key == "--bbs")
+		{
+			bbs = value;
+		}
+		else if(key == "--directory")
+		{
+			directory = value;
+		}
+		else if(key == "--output")
+		{
+			output = value;
+		}
+		else if(numbers.count(key) && !value.empty())
+		{
+			try
+			{
+				*numbers.at(key) = std::stoul(value);
+			}
+			catch(const std::logic_error&)
+			{
+				// The value is not a number or it doesn't fit
+				std::cout << help << std::endl;
+				return 1;
+			}
+		}
+		else
+		{
+			std::cout << help << std::endl;
+			return key == "--help" ? 0 : 1;
+		}
+	}
+
+	// Generate a fresh project tree
+	fs::remove_all(directory);
+	auxillary::Generator generator{options};
+	generator.Generate(directory);
+
+	std::vector<Sample> samples{};
+	for(std::size_t i = 0; i < repetitions; ++i)
+	{
+		// Remove the output of the previous builds
+		for(const auto& name : generator.GetProjectNames())
+		{
+			fs::remove_all(directory / name);
+		}
+		samples.push_back(Build(bbs, directory, "full"));
+
+		// Nothing has changed, so nothing should be rebuilt
+		samples.push_back(Build(bbs, directory, "null"));
+
+		// Invalidate the units, including the first chain of headers, if there are any
+		if(const auto& header = generator.GetDeepestHeader(); !header.empty())
+		{
+			fs::last_write_time(header, fs::file_time_type::clock::now());
+			samples.push_back(Build(bbs, directory, "touch"));
+		}
+	}
+
+	if(output.empty())
+	{
+		WriteResults(std::cout, options, samples);
+		return 0;
+	}
+
+	std::ofstream stream{output};
+	WriteResults(stream, options, samples);
+	return 0;
+}
@@ -0,0 +1,167 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+
+#include "auxillary/generator.hpp"
+#include "lexer/lexer.hpp"
+#include "parser/cache.hpp"
+#include "parser/parser.hpp"
+
+namespace fs = std::filesystem;
+
+namespace constants
+{
+constexpr std::size_t kBytesPerVariable = 256;
+constexpr std::size_t kBytesPerFile = 19;
+} // namespace constants
+
+/**
+ * @brief Get a build file of (approximately) the given size, creating it if needed
+ * 
+ * @note About a tenth of the file declares variables, the rest lists the files, each of them
+ *       referencing the "src" variable
+ * 
+ * @param size - the size of the build file
+ * @return fs::path - the path to the build file
+ */
+static fs::path GetBuildFile(std::size_t size)
+{
+	const auto folder = fs::temp_directory_path() / "bbs-parser";
+	const auto path = folder / (std::to_string(size) + ".bbs");
+	if(fs::exists(path))
+	{
+		return path;
+	}
+
+	auxillary::Generator::Project project{"parser", {}, {}, {}, size / constants::kBytesPerVariable};
+	const auto files = size * 7 / 8 / constants::kBytesPerFile;
+	for(std::size_t i = 0; i < std::max<std::size_t>(files, 1); ++i)
+	{
+		project.files.push_back("u" + auxillary::Generator::GetName(i) + ".cpp");
+	}
+
+	fs::create_directories(folder);
+	std::ofstream stream{path};
+	auxillary::Generator::WriteBuildFile(stream, project);
+	return path;
+}
+
+/**
+ * @brief Count the tokens in the given build file
+ * 
+ * @param path - the path to the build file
+ * @return std::size_t - the number of tokens
+ */
+static std::size_t CountTokens(const fs::path& path)
+{
+	static std::map<fs::path, std::size_t> counts{};
+	if(counts.count(path))
+	{
+		return counts.at(path);
+	}
+
+	std::size_t count = 0;
+	lexer::Lexer lexer{path};
+	while(lexer.Next())
+	{
+		++count;
+	}
+
+	return counts[path] = count;
+}
+
+/**
+ * @brief Report the throughput of the benchmark
+ * 
+ * @param state - the state of the benchmark
+ * @param path - the processed build file
+ */
+static void SetThroughput(benchmark::State& state, const fs::path& path)
+{
+	const auto iterations = static_cast<double>(state.iterations());
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * fs::file_size(path)));
+	state.counters["tokens_per_second"] = benchmark::Counter(
+		iterations * static_cast<double>(CountTokens(path)), benchmark::Counter::kIsRate);
+}
+
+/**
+ * @brief Measure the throughput of the lexer alone
+ * 
+ * @param state - the state of the benchmark: the size of the build file
+ */
+static void BM_Lex(benchmark::State& state)
+{
+	const auto path = GetBuildFile(static_cast<std::size_t>(state.range(0)));
+	for(auto _ : state)
+	{
+		lexer::Lexer lexer{path};
+		while(lexer.Next())
+		{
+			// noop
+		}
+	}
+
+	SetThroughput(state, path);
+}
+
+/**
+ * @brief Measure the throughput of the parser (including the lexer it drives)
+ * 
+ * @param state - the state of the benchmark: the size of the build file
+ */
+static void BM_Parse(benchmark::State& state)
+{
+	const auto path = GetBuildFile(static_cast<std::size_t>(state.range(0)));
+	for(auto _ : state)
+	{
+		parser::Parser parser{path};
+		benchmark::DoNotOptimize(parser.Process());
+	}
+
+	SetThroughput(state, path);
+}
+
+/**
+ * @brief Measure the throughput of loading the job of an unchanged build file from the cache
+ * 
+ * @param state - the state of the benchmark: the size of the build file
+ */
+static void BM_Load(benchmark::State& state)
+{
+	const auto path = GetBuildFile(static_cast<std::size_t>(state.range(0)));
+	const parser::Cache cache{fs::temp_directory_path() / "bbs-parser" / "cache"};
+	cache.Store(path, parser::Parser{path}.Process());
+	for(auto _ : state)
+	{
+		benchmark::DoNotOptimize(cache.Load(path));
+	}
+
+	SetThroughput(state, path);
+}
+
+BENCHMARK(BM_Lex)->ArgName("bytes")->RangeMultiplier(10)->Range(1 << 10, 100 << 20);
+BENCHMARK(BM_Parse)->ArgName("bytes")->RangeMultiplier(10)->Range(1 << 10, 100 << 20);
+BENCHMARK(BM_Load)->ArgName("bytes")->RangeMultiplier(10)->Range(1 << 10, 100 << 20);
+
+BENCHMARK_MAIN();
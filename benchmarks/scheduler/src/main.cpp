@@ -0,0 +1,191 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+
+#include "auxillary/compilers/delayedcompiler.hpp"
+#include "auxillary/generator.hpp"
+#include "scheduler/executor.hpp"
+#include "scheduler/pipeline/job.hpp"
+#include "scheduler/pipeline/pipeline.hpp"
+#include "sys/tools/compilerfactory.hpp"
+#include "sys/tools/compilers/gnuplusplus.hpp"
+
+namespace fs = std::filesystem;
+
+using compilers::DelayedCompiler;
+
+/**
+ * @brief Get the folder with the given number of empty sources, creating it if needed
+ * 
+ * @param count - the number of sources
+ * @return fs::path - the folder with the sources
+ */
+static fs::path GetSources(std::size_t count)
+{
+	static std::map<std::size_t, fs::path> folders{};
+	if(folders.count(count))
+	{
+		return folders.at(count);
+	}
+
+	const auto folder = fs::temp_directory_path() / "bbs-scheduler" / std::to_string(count);
+	fs::create_directories(folder);
+	for(std::size_t i = 0; i < count; ++i)
+	{
+		const auto file = folder / ("u" + auxillary::Generator::GetName(i) + ".cpp");
+		if(!fs::exists(file))
+		{
+			std::ofstream{file};
+		}
+	}
+
+	return folders[count] = folder;
+}
+
+/**
+ * @brief Get the gaps between the compilations, run one after another by the same worker
+ * 
+ * @param records - the records about the compilations
+ * @return std::vector<double> - the sorted gaps in microseconds
+ */
+static std::vector<double> GetLatencies(DelayedCompiler::Records& records)
+{
+	const auto count = std::min(records.next.load(), records.values.size());
+	auto values = std::vector<DelayedCompiler::Record>(records.values.begin(),
+													   records.values.begin() + count);
+	std::sort(values.begin(), values.end(), [](const auto& lhs, const auto& rhs) {
+		return lhs.thread != rhs.thread ? lhs.thread < rhs.thread : lhs.start < rhs.start;
+	});
+
+	std::vector<double> latencies{};
+	for(std::size_t i = 1; i < values.size(); ++i)
+	{
+		if(values[i].thread == values[i - 1].thread)
+		{
+			const std::chrono::duration<double, std::micro> gap{values[i].start -
+																values[i - 1].end};
+			latencies.push_back(gap.count());
+		}
+	}
+
+	std::sort(latencies.begin(), latencies.end());
+	return latencies;
+}
+
+/**
+ * @brief Measure the overhead of scheduling compilations that cost nothing (or the given delay)
+ * 
+ * @param state - the state of the benchmark: the number of actions, the number of jobs,
+ *                the mean delay in microseconds and the distribution of the delays
+ */
+static void BM_Schedule(benchmark::State& state)
+{
+	const auto actions = static_cast<std::size_t>(state.range(0));
+	const auto jobs = static_cast<std::size_t>(state.range(1));
+	const std::chrono::microseconds delay{state.range(2)};
+	const auto distribution = static_cast<DelayedCompiler::Distribution>(state.range(3));
+
+	const auto sources = GetSources(actions);
+
+	// Every pipeline of the run gets a compiler, sharing the same records
+	auto records = std::make_shared<DelayedCompiler::Records>(0);
+	sys::tools::CompilerFactory::Register(
+		sys::tools::compilers::GNUPlusPlus::kCompiler, [&records, delay, distribution](auto, auto) {
+			return std::make_unique<DelayedCompiler>(records, delay, distribution);
+		});
+
+	std::vector<double> latencies{};
+	for(auto _ : state)
+	{
+		state.PauseTiming();
+		records = std::make_shared<DelayedCompiler::Records>(actions);
+
+		scheduler::pipeline::Job job{"scheduler"};
+		job.SetProjectPath(sources);
+		for(std::size_t i = 0; i < actions; ++i)
+		{
+			job.AddFile("u" + auxillary::Generator::GetName(i) + ".cpp");
+		}
+
+		scheduler::Executor executor{jobs};
+		executor.Add(scheduler::pipeline::Pipeline{std::move(job)});
+		state.ResumeTiming();
+
+		executor.Run();
+
+		state.PauseTiming();
+		const auto values = GetLatencies(*records);
+		latencies.insert(latencies.end(), values.begin(), values.end());
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * actions));
+
+	std::sort(latencies.begin(), latencies.end());
+	if(!latencies.empty())
+	{
+		double sum = 0.0;
+		for(const auto value : latencies)
+		{
+			sum += value;
+		}
+
+		state.counters["latency_mean_us"] = sum / static_cast<double>(latencies.size());
+		state.counters["latency_p50_us"] = latencies[latencies.size() / 2];
+		state.counters["latency_p99_us"] = latencies[latencies.size() * 99 / 100];
+	}
+}
+
+// Zero-cost compilations show the pure overhead of the scheduler
+BENCHMARK(BM_Schedule)
+	->ArgNames({"actions", "jobs", "delay_us", "distribution"})
+	->ArgsProduct({{1000, 100000}, {1, 2, 4, 8, 16}, {0}, {0}})
+	->Unit(benchmark::kMillisecond)
+	->UseRealTime();
+
+// Compilations with an exponentially distributed cost show how the scheduler scales
+BENCHMARK(BM_Schedule)
+	->ArgNames({"actions", "jobs", "delay_us", "distribution"})
+	->ArgsProduct({{10000}, {1, 2, 4, 8, 16}, {100}, {2}})
+	->Unit(benchmark::kMillisecond)
+	->UseRealTime();
+
+int main(int argc, char** argv)
+{
+	// The pipelines put their output into the current folder
+	const auto folder = fs::temp_directory_path() / "bbs-scheduler" / "output";
+	fs::create_directories(folder);
+	fs::current_path(folder);
+
+	benchmark::Initialize(&argc, argv);
+	if(benchmark::ReportUnrecognizedArguments(argc, argv))
+	{
+		return 1;
+	}
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
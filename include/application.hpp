@@ -19,9 +19,17 @@
 
 #pragma once
 
+#include <cstddef>
 #include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
 
+#include "parser/cache.hpp"
 #include "scheduler/executor.hpp"
+#include "scheduler/threadpool.hpp"
+#include "sys/walker.hpp"
 
 /**
  * @brief The application implementation that puts everything together
@@ -31,7 +39,16 @@ class Application
 {
 public:
 	/**
-	 * @brief Process the top-level project
+	 * @brief Construct a new Application object
+	 * 
+	 * @param jobs - the number of actions to run simultaneously
+	 * @param unity - true if the files of the projects are grouped into the unity files, false otherwise
+	 */
+	explicit Application(std::size_t jobs = 1, bool unity = false);
+
+public:
+	/**
+	 * @brief Process the top-level project and all of it's dependencies
 	 * 
 	 * @param path - the path to the top-level project
 	 */
@@ -44,9 +61,77 @@ public:
 	void Build();
 
 protected:
+	/**
+	 * @brief Parse the build file of the project and submit it's dependencies to the pool
+	 * 
+	 * @param pool - the pool that parses the build files
+	 * @param path - the path to the project
+	 */
+	void Discover(scheduler::ThreadPool& pool, std::filesystem::path path);
+
+	/**
+	 * @brief Add pipelines of the project's dependencies and then of the project to the executor
+	 * 
+	 * @param path - the path to the project
+	 * @param visited - the projects that are already scheduled
+	 */
+	void Schedule(const std::filesystem::path& path, std::set<std::filesystem::path>& visited);
+
+	/**
+	 * @brief Replace the glob patterns among the files of the job with the files they match
+	 * 
+	 * @param job - the job to expand the files of
+	 */
+	void ExpandFiles(scheduler::pipeline::Job& job);
+
+	/**
+	 * @brief Get the path that identifies the project in the graph
+	 * 
+	 * @param path - the path to the project
+	 * @return std::filesystem::path - the normalized path
+	 */
+	static std::filesystem::path Normalize(const std::filesystem::path& path);
+
+protected:
+	/**
+	 * @brief The number of actions to run simultaneously
+	 * 
+	 */
+	std::size_t jobs_;
+
+	/**
+	 * @brief Whether the files of the projects are grouped into the unity files
+	 * 
+	 */
+	bool unity_;
+
 	/**
 	 * @brief The executor that runs pipelines
 	 * 
 	 */
 	scheduler::Executor executor_;
+
+	/**
+	 * @brief The cache of parsed build files
+	 * 
+	 */
+	parser::Cache cache_;
+
+	/**
+	 * @brief The walker that expands the glob patterns of the files
+	 * 
+	 */
+	sys::Walker walker_;
+
+	/**
+	 * @brief The graph of the discovered projects, a project without a job has failed to parse
+	 * 
+	 */
+	std::map<std::filesystem::path, std::optional<scheduler::pipeline::Job>> projects_;
+
+	/**
+	 * @brief The mutex that guards the graph of the projects
+	 * 
+	 */
+	std::mutex mutex_;
 };
\ No newline at end of file
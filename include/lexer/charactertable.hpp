@@ -0,0 +1,109 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "parser/tokens/operator.hpp"
+#include "parser/tokens/punctuator.hpp"
+#include "parser/tokens/separator.hpp"
+
+namespace lexer
+{
+/**
+ * @brief The class of a character, which defines the kind of the token it starts
+ * 
+ */
+enum class CharacterClass : uint8_t
+{
+	kInvalid,
+	kLetter,
+	kPunctuator,
+	kSeparator,
+	kOperator
+};
+
+/**
+ * @brief An entry of the character table
+ * 
+ */
+struct CharacterEntry
+{
+	/**
+	 * @brief The class of the character
+	 * 
+	 */
+	CharacterClass type{CharacterClass::kInvalid};
+
+	/**
+	 * @brief The type of the token inside its class (e.g. Punctuator::Type), if any
+	 * 
+	 */
+	uint8_t subtype{0};
+};
+
+/**
+ * @brief Build the table of all the characters, recognized by the lexer
+ * 
+ * @return std::array<CharacterEntry, 256> - the table, indexed by the value of the character
+ */
+constexpr std::array<CharacterEntry, 256> MakeCharacterTable()
+{
+	using parser::tokens::Operator;
+	using parser::tokens::Punctuator;
+	using parser::tokens::Separator;
+
+	std::array<CharacterEntry, 256> table{};
+	const auto set = [&table](char character, CharacterClass type, auto subtype) {
+		table[static_cast<unsigned char>(character)] = {type, static_cast<uint8_t>(subtype)};
+	};
+
+	for(char character = 'a'; character <= 'z'; ++character)
+	{
+		set(character, CharacterClass::kLetter, 0);
+		set(static_cast<char>(character - 'a' + 'A'), CharacterClass::kLetter, 0);
+	}
+
+	set('[', CharacterClass::kPunctuator, Punctuator::Type::kLeftSquareBracket);
+	set(']', CharacterClass::kPunctuator, Punctuator::Type::kRightSquareBracket);
+	set('!', CharacterClass::kPunctuator, Punctuator::Type::kExclamationMark);
+	set('\"', CharacterClass::kPunctuator, Punctuator::Type::kDoubleQuoteMark);
+	set('.', CharacterClass::kPunctuator, Punctuator::Type::kDot);
+	set(',', CharacterClass::kPunctuator, Punctuator::Type::kComma);
+	set('/', CharacterClass::kPunctuator, Punctuator::Type::kSlash);
+	set('\\', CharacterClass::kPunctuator, Punctuator::Type::kBackslash);
+	set('-', CharacterClass::kPunctuator, Punctuator::Type::kMinus);
+	set('*', CharacterClass::kPunctuator, Punctuator::Type::kAsterisk);
+	set('?', CharacterClass::kPunctuator, Punctuator::Type::kQuestionMark);
+
+	set(' ', CharacterClass::kSeparator, Separator::Type::kSpace);
+
+	set('=', CharacterClass::kOperator, Operator::Type::kEqualitySign);
+	set('$', CharacterClass::kOperator, Operator::Type::kDollarSign);
+	return table;
+}
+
+/**
+ * @brief The table of all the characters, recognized by the lexer
+ * 
+ */
+inline constexpr auto kCharacterTable = MakeCharacterTable();
+} // namespace lexer
\ No newline at end of file
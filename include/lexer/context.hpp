@@ -21,7 +21,7 @@
 
 #include <cstdint>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace lexer
 {
@@ -35,16 +35,16 @@ public:
 	/**
       * @brief Update the string inside the context
       * 
-      * @param value - the value of the string
+      * @param value - the view of the line, it must outlive the context or the next update
       */
-	void Update(std::string&& value);
+	void Update(std::string_view value);
 
 	/**
       * @brief Get the internal line
       * 
-      * @return std::string - the internal line
+      * @return std::string_view - the internal line
       */
-	std::string GetLine() const;
+	std::string_view GetLine() const;
 
 	/**
       * @brief Get the current character
@@ -78,7 +78,7 @@ protected:
      * @brief The value of the line
      * 
      */
-	std::string line_;
+	std::string_view line_;
 
 	/**
      * @brief Line's index inside the file
@@ -90,6 +90,6 @@ protected:
      * @brief Current position in the line
      * 
      */
-	std::string::iterator position_;
+	std::size_t position_{0};
 };
 } // namespace lexer
\ No newline at end of file
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include "lexer/handlers/handler.hpp"
@@ -30,9 +31,13 @@ namespace lexer
 /**
  * @brief Conversion of a text into meaningful lexical tokens
  * 
+ * @note By default the characters are classified with a constant table in a single pass,
+ *       a custom chain of handlers can be installed to extend the language
+ * 
  */
 class Lexer
 {
+	using Lexeme = parser::tokens::Lexeme;
 	using Token = parser::tokens::Token;
 
 public:
@@ -47,16 +52,16 @@ public:
 	/**
      * @brief Get the next available token
      * 
-     * @return std::shared_ptr<Token> - a pointer to the next token or nullptr 
+     * @return const Lexeme* - a pointer to the next token or nullptr, valid until the next call
      */
-	std::shared_ptr<Token> Next();
+	const Lexeme* Next();
 
 	/**
      * @brief Get the available token
      * 
-     * @return std::shared_ptr<Token> - a pointer to the next token or nullptr 
+     * @return const Lexeme* - a pointer to the available token or nullptr
      */
-	std::shared_ptr<Token> Get() const;
+	const Lexeme* Get() const;
 
 	/**
       * @brief Get the current context
@@ -65,6 +70,21 @@ public:
       */
 	const Context& GetContext() const;
 
+	/**
+      * @brief Set the chain of handlers, which replaces the default table-driven scanning
+      * 
+      * @param handler - the first handler of the chain
+      */
+	void SetHandler(std::unique_ptr<handlers::Handler> handler);
+
+protected:
+	/**
+      * @brief Scan the next token using the character table
+      * 
+      * @return std::optional<Lexeme> - the next token, if any
+      */
+	std::optional<Lexeme> Scan();
+
 protected:
 	/**
      * @brief An abstraction used to strip the lexer of I/O operations and comment/empty line handling
@@ -73,15 +93,21 @@ protected:
 	Scanner scanner_;
 
 	/**
-     * @brief A set of handlers, used to distinguish between different types of tokens
+     * @brief A set of handlers, used to distinguish between different types of tokens (optional)
      * 
      */
 	std::unique_ptr<handlers::Handler> handler_;
 
+	/**
+      * @brief The newest token, produced by the chain of handlers (the lexeme refers to it)
+      * 
+      */
+	std::shared_ptr<Token> extension_;
+
 	/**
       * @brief The newest read token
       * 
       */
-	std::shared_ptr<Token> token_;
+	std::optional<Lexeme> token_;
 };
 } // namespace lexer
\ No newline at end of file
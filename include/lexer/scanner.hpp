@@ -20,10 +20,11 @@
 #pragma once
 
 #include <filesystem>
-#include <fstream>
 #include <optional>
+#include <string_view>
 
 #include "lexer/context.hpp"
+#include "sys/mappedfile.hpp"
 
 namespace lexer
 {
@@ -31,6 +32,8 @@ namespace lexer
  * @brief The class is used to handle file I/O operations and lift the weight
  *        of processing whitespaces, tabs and comments off the lexer
  * 
+ * @note The file is mapped into memory once, the lines and lexemes are views into the mapping
+ * 
  */
 class Scanner
 {
@@ -62,6 +65,27 @@ public:
      */
 	void Move();
 
+	/**
+     * @brief Move over the given number of characters of the current line
+     * 
+     * @param count - the number of characters to skip, must not exceed the size of Peek()
+     */
+	void Move(std::size_t count);
+
+	/**
+     * @brief Get the rest of the current line, starting with the available character
+     * 
+     * @return std::string_view - a view into the file, empty at the end of the file
+     */
+	std::string_view Peek() const;
+
+	/**
+     * @brief Get the offset of the available character from the beginning of the file
+     * 
+     * @return std::size_t - the offset in bytes
+     */
+	std::size_t GetOffset() const;
+
 	/**
       * @brief Get the current context
       * 
@@ -76,12 +100,31 @@ protected:
       */
 	void Skip();
 
+	/**
+      * @brief Read the next line of the file into the context
+      * 
+      * @return true if there was a line to read, false at the end of the file
+      */
+	bool Read();
+
 protected:
 	/**
      * @brief The file which is processed
      * 
      */
-	std::ifstream file_;
+	sys::MappedFile file_;
+
+	/**
+     * @brief The part of the file which has not been read yet
+     * 
+     */
+	std::string_view data_;
+
+	/**
+     * @brief Whether the end of the file was reached
+     * 
+     */
+	bool finished_{false};
 
 	/**
      * @brief The current context
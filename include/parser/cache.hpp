@@ -0,0 +1,89 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+#include "scheduler/pipeline/job.hpp"
+
+namespace parser
+{
+/**
+ * @brief A binary cache of parsed build files, used to skip lexing and parsing of unchanged ones
+ * 
+ * @note Every build file has a single entry, which is valid as long as the hash of the
+ *       file's contents matches the one stored in the entry. Variables are declared in the
+ *       build file itself, so the contents' hash covers all the variables the file reads.
+ */
+class Cache
+{
+public:
+	/**
+     * @brief Construct a new Cache object
+     * 
+     * @param directory - the directory to keep the entries in
+     */
+	explicit Cache(std::filesystem::path directory);
+
+public:
+	/**
+     * @brief Load the job of the build file, if the file hasn't changed since it was stored
+     * 
+     * @param file - the path to the build file
+     * @return std::optional<scheduler::pipeline::Job> - the cached job, if there is a valid entry
+     */
+	std::optional<scheduler::pipeline::Job> Load(const std::filesystem::path& file) const;
+
+	/**
+     * @brief Store the job, parsed from the build file, failures are silently ignored
+     * 
+     * @param file - the path to the build file
+     * @param job - the job to store
+     */
+	void Store(const std::filesystem::path& file, const scheduler::pipeline::Job& job) const;
+
+protected:
+	/**
+     * @brief Get the path to the entry of the build file
+     * 
+     * @param file - the path to the build file
+     * @return std::filesystem::path - the path to the entry
+     */
+	std::filesystem::path GetEntryPath(const std::filesystem::path& file) const;
+
+	/**
+     * @brief Hash the given data with 64-bit FNV-1a
+     * 
+     * @param data - the data to hash
+     * @return std::uint64_t - the hash
+     */
+	static std::uint64_t Hash(std::string_view data);
+
+protected:
+	/**
+     * @brief The directory the entries are kept in
+     * 
+     */
+	std::filesystem::path directory_;
+};
+} // namespace parser
\ No newline at end of file
@@ -19,12 +19,11 @@
 
 #pragma once
 
-#include "scheduler/pipeline/job.hpp"
+#include <string_view>
 
-namespace parser::states
-{
-class State;
-}
+#include "parser/states/type.hpp"
+#include "parser/symboltable.hpp"
+#include "scheduler/pipeline/job.hpp"
 
 namespace parser
 {
@@ -41,16 +40,16 @@ public:
 	/**
      * @brief Set the new state
      * 
-     * @param state - the state to set
+     * @param state - the identifier of the state to set
      */
-	void SetState(std::unique_ptr<states::State> state);
+	void SetState(states::Type state);
 
 	/**
-     * @brief Get the parser's state
+     * @brief Get the parser's state and reset it, so the parser stops unless a new state is set
      * 
-     * @return std::unique_ptr<states::State> - current parser's state
+     * @return states::Type - current parser's state
      */
-	std::unique_ptr<states::State> GetState();
+	states::Type GetState();
 
 	/**
       * @brief Set the job after it's creation
@@ -79,22 +78,22 @@ public:
 	 * @param id - variable's name
 	 * @param value - variable's value
 	 */
-	void DeclareVariable(std::string id, std::string value);
+	void DeclareVariable(std::string_view id, std::string_view value);
 
 	/**
 	 * @brief Get the variable's value
 	 * 
 	 * @param id - variable's name
-	 * @return std::string - the value of the variable, if it exists
+	 * @return std::string_view - the value of the variable, valid as long as the mediator lives
 	 */
-	std::string GetVariableValue(std::string id) const;
+	std::string_view GetVariableValue(std::string_view id) const;
 
 protected:
 	/**
      * @brief The current Parser's state
      * 
      */
-	std::unique_ptr<states::State> state_;
+	states::Type state_;
 
 	/**
       * @brief The job that is filled
@@ -106,6 +105,6 @@ protected:
 	 * @brief The declared variables
 	 * 
 	 */
-	std::map<std::string, std::string> variables_;
+	SymbolTable variables_;
 };
 } // namespace parser
\ No newline at end of file
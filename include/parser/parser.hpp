@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 
 #include "lexer/context.hpp"
@@ -57,6 +58,15 @@ public:
      */
 	scheduler::pipeline::Job Process();
 
+protected:
+	/**
+      * @brief Get the preallocated state by it's identifier
+      * 
+      * @param type - the identifier of the state
+      * @return states::State& - a reference to the state instance
+      */
+	states::State& GetState(states::Type type);
+
 protected:
 	/**
      * @brief The lexer to use to process the script
@@ -69,5 +79,11 @@ protected:
       * 
       */
 	Mediator mediator_;
+
+	/**
+      * @brief The states of the parser, indexed by their identifiers and reused for every statement
+      * 
+      */
+	std::array<std::unique_ptr<states::State>, states::kTypeCount> states_;
 };
 } // namespace parser
\ No newline at end of file
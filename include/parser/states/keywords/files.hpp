@@ -44,5 +44,13 @@ public:
      * @param lexer - the lexer which handles tokenization of the input file
      */
 	void Process(lexer::Lexer& lexer);
+
+protected:
+	/**
+     * @brief Add the element to the job as soon as it is parsed
+     * 
+     * @param value - the element
+     */
+	void Add(std::string value) override;
 };
 } // namespace parser::states::keywords
\ No newline at end of file
@@ -0,0 +1,56 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include "parser/states/types/array.hpp"
+
+namespace parser::states::keywords
+{
+/**
+ * @brief An "Isolated" state of the parser, used to parse !isolated keyword
+ * 
+ */
+class Isolated : public types::Array
+{
+public:
+	/**
+     * @brief Construct a new Isolated object
+     * 
+     * @param mediator - the associated parser's mediator
+     */
+	explicit Isolated(Mediator& mediator);
+
+public:
+	/**
+     * @brief Process the input from the lexer
+     * 
+     * @param lexer - the lexer which handles tokenization of the input file
+     */
+	void Process(lexer::Lexer& lexer);
+
+protected:
+	/**
+     * @brief Add the element to the job as soon as it is parsed
+     * 
+     * @param value - the element
+     */
+	void Add(std::string value) override;
+};
+} // namespace parser::states::keywords
\ No newline at end of file
@@ -53,6 +53,6 @@ protected:
       * @param token - the token to check
       * @param value - the value to check the token against
       */
-	void Match(tokens::Token* token, tokens::Operator::Type value);
+	void Match(const tokens::Lexeme* token, tokens::Operator::Type value);
 };
 } // namespace parser::states::keywords
\ No newline at end of file
@@ -19,7 +19,7 @@
 
 #pragma once
 
-#include "parser/states/types/array.hpp"
+#include "parser/states/types/commands.hpp"
 
 namespace parser::states::keywords
 {
@@ -27,7 +27,7 @@ namespace parser::states::keywords
  * @brief A "Pre" state of the parser, used to parse !pre keyword
  * 
  */
-class Pre : public types::Array
+class Pre : public types::Commands
 {
 public:
 	/**
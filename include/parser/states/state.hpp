@@ -21,6 +21,7 @@
 
 #include "lexer/lexer.hpp"
 #include "parser/mediator.hpp"
+#include "parser/tokens/operator.hpp"
 #include "parser/tokens/punctuator.hpp"
 
 namespace parser::states
@@ -52,9 +53,9 @@ protected:
       * @brief Skip the separator tokens
       * 
       * @param lexer - the lexer to get tokens from
-      * @return std::shared_ptr<tokens::Token> - the token next to the separator
+      * @return const tokens::Lexeme* - the token next to the separator or nullptr
       */
-	static std::shared_ptr<tokens::Token> SkipSeparators(lexer::Lexer& lexer);
+	static const tokens::Lexeme* SkipSeparators(lexer::Lexer& lexer);
 
 	/**
       * @brief Match the token with the given punctuator type
@@ -62,7 +63,25 @@ protected:
       * @param token - the token to check
       * @param value - the value to check the token against
       */
-	void Match(tokens::Token* token, tokens::Punctuator::Type value);
+	void Match(const tokens::Lexeme* token, tokens::Punctuator::Type value);
+
+	/**
+      * @brief Check if the token is the punctuator of the given type, without throwing
+      * 
+      * @param token - the token to check, might be nullptr
+      * @param value - the value to check the token against
+      * @return true if the token matches, false otherwise
+      */
+	static bool Is(const tokens::Lexeme* token, tokens::Punctuator::Type value);
+
+	/**
+      * @brief Check if the token is the operator of the given type, without throwing
+      * 
+      * @param token - the token to check, might be nullptr
+      * @param value - the value to check the token against
+      * @return true if the token matches, false otherwise
+      */
+	static bool Is(const tokens::Lexeme* token, tokens::Operator::Type value);
 
 protected:
 	/**
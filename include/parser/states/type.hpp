@@ -0,0 +1,53 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace parser::states
+{
+/**
+ * @brief Identifiers of the parser's states, used to switch between them without allocations
+ * 
+ */
+enum class Type : uint8_t
+{
+	kNone,
+	kStatement,
+	kKeyword,
+	kCFlags,
+	kDeps,
+	kFiles,
+	kInc,
+	kIsolated,
+	kLet,
+	kPch,
+	kPost,
+	kPre,
+	kProject,
+};
+
+/**
+ * @brief The number of the parser's states, including kNone
+ * 
+ */
+inline constexpr std::size_t kTypeCount{static_cast<std::size_t>(Type::kProject) + 1};
+} // namespace parser::states
\ No newline at end of file
@@ -51,9 +51,31 @@ public:
 	/**
       * @brief Get the array's value
       * 
-      * @return std::vector<std::string> 
+      * @return const std::vector<std::string>& - the elements, kept by the default Add()
       */
-	std::vector<std::string> GetValue() const;
+	const std::vector<std::string>& GetValue() const;
+
+protected:
+	/**
+      * @brief Handle an element of the array as soon as it is parsed
+      * 
+      * @note By default the element is kept in the array's value, the states that consume
+      *       the elements one by one override it to avoid keeping the whole list twice
+      * 
+      * @param value - the element
+      */
+	virtual void Add(std::string value);
+
+	/**
+      * @brief Handle the clauses, which follow an element of the array
+      * 
+      * @note By default the elements have no clauses, so the token is returned as is
+      * 
+      * @param lexer - the lexer which handles tokenization of the input file
+      * @param token - the first token after the element
+      * @return const tokens::Lexeme* - the first token after the clauses
+      */
+	virtual const tokens::Lexeme* ProcessClauses(lexer::Lexer& lexer, const tokens::Lexeme* token);
 
 private:
 	/**
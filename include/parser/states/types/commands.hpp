@@ -0,0 +1,95 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "parser/states/types/array.hpp"
+#include "scheduler/pipeline/job.hpp"
+
+namespace parser::states::types
+{
+/**
+ * @brief A "Commands" state of the parser, used to parse arrays of commands
+ * 
+ * @note Every command might be followed by the files it reads and creates:
+ *       "command" in ["input", ...] out ["output", ...] serial
+ */
+class Commands : public Array
+{
+public:
+	/**
+     * @brief Construct a new Commands object
+     * 
+     * @param mediator - the associated parser's mediator
+     */
+	explicit Commands(Mediator& mediator);
+
+public:
+	/**
+     * @brief Process the input from the lexer
+     * 
+     * @param lexer - the lexer which handles tokenization of the input file
+     */
+	void Process(lexer::Lexer& lexer) override;
+
+	/**
+      * @brief Get the commands
+      * 
+      * @return const std::vector<scheduler::pipeline::Job::Command>& - the commands, in the order of the array
+      */
+	const std::vector<scheduler::pipeline::Job::Command>& GetCommands() const;
+
+protected:
+	/**
+      * @brief Add the command with no files declared
+      * 
+      * @param value - the line of the command
+      */
+	void Add(std::string value) override;
+
+	/**
+      * @brief Handle the inputs, the outputs and the serial marker of the command, if any
+      * 
+      * @param lexer - the lexer which handles tokenization of the input file
+      * @param token - the first token after the command
+      * @return const tokens::Lexeme* - the first token after the files
+      */
+	const tokens::Lexeme* ProcessClauses(lexer::Lexer& lexer, const tokens::Lexeme* token) override;
+
+	/**
+      * @brief Check if the token is the given word
+      * 
+      * @param token - the token to check, might be nullptr
+      * @param value - the value to check the token against
+      * @return true if the token matches, false otherwise
+      */
+	static bool IsWord(const tokens::Lexeme* token, std::string_view value);
+
+private:
+	/**
+      * @brief The commands of the array
+      * 
+      */
+	std::vector<scheduler::pipeline::Job::Command> commands_;
+};
+} // namespace parser::states::types
@@ -50,9 +50,9 @@ public:
 	/**
       * @brief Get the string's value
       * 
-      * @return std::string 
+      * @return const std::string& - the value, valid until the state processes the next string
       */
-	std::string GetValue() const;
+	const std::string& GetValue() const;
 
 	/**
        * @brief Clear the internal value
@@ -19,7 +19,7 @@
 
 #pragma once
 
-#include <string>
+#include <string_view>
 
 #include "parser/states/state.hpp"
 
@@ -48,11 +48,11 @@ public:
 	void Process(lexer::Lexer& lexer);
 
 	/**
-      * @brief Get the string's value
+      * @brief Get the variable's value
       * 
-      * @return std::string 
+      * @return std::string_view - the value, owned by the mediator
       */
-	std::string GetValue() const;
+	std::string_view GetValue() const;
 
 	/**
        * @brief Clear the internal value
@@ -62,9 +62,9 @@ public:
 
 private:
 	/**
-      * @brief The value of the string
+      * @brief The value of the variable
       * 
       */
-	std::string value_;
+	std::string_view value_;
 };
 } // namespace parser::states
\ No newline at end of file
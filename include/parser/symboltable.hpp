@@ -0,0 +1,131 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace parser
+{
+/**
+ * @brief A flat open-addressing table of interned symbols, mapping names onto values
+ * 
+ * @note The names and the values are copied into the table once, the views returned by
+ *       the table stay valid as long as the table lives
+ */
+class SymbolTable
+{
+public:
+	/**
+	 * @brief Insert a new symbol, an existing symbol with the same name is kept unchanged
+	 * 
+	 * @param name - symbol's name
+	 * @param value - symbol's value
+	 * @return true if the symbol was inserted, false if the name is already taken
+	 */
+	bool Insert(std::string_view name, std::string_view value);
+
+	/**
+	 * @brief Find the value of the symbol
+	 * 
+	 * @param name - symbol's name
+	 * @return std::optional<std::string_view> - the value of the symbol, if it exists
+	 */
+	std::optional<std::string_view> Find(std::string_view name) const;
+
+	/**
+	 * @brief Get the number of symbols
+	 * 
+	 * @return std::size_t - the number of symbols in the table
+	 */
+	std::size_t GetSize() const;
+
+protected:
+	/**
+	 * @brief A slot of the table
+	 * 
+	 */
+	struct Slot
+	{
+		/**
+		 * @brief The name of the symbol, kept in the table's storage
+		 * 
+		 */
+		std::string_view name;
+
+		/**
+		 * @brief The value of the symbol, kept in the table's storage
+		 * 
+		 */
+		std::string_view value;
+
+		/**
+		 * @brief Whether the slot holds a symbol
+		 * 
+		 */
+		bool used{false};
+	};
+
+	/**
+	 * @brief Find the slot the symbol is kept in, or the free slot it should be put to
+	 * 
+	 * @param name - symbol's name
+	 * @return std::size_t - the index of the slot
+	 */
+	std::size_t Probe(std::string_view name) const;
+
+	/**
+	 * @brief Double the number of slots, keeping the table at most half full
+	 * 
+	 */
+	void Grow();
+
+	/**
+	 * @brief Copy the string into the table's storage
+	 * 
+	 * @param value - the string to copy
+	 * @return std::string_view - the view of the copy
+	 */
+	std::string_view Intern(std::string_view value);
+
+protected:
+	/**
+	 * @brief The slots of the table, the number of slots is always a power of two
+	 * 
+	 */
+	std::vector<Slot> slots_;
+
+	/**
+	 * @brief The number of used slots
+	 * 
+	 */
+	std::size_t size_{0};
+
+	/**
+	 * @brief The storage of the names and values, the elements are never moved
+	 * 
+	 */
+	std::deque<std::string> strings_;
+};
+} // namespace parser
\ No newline at end of file
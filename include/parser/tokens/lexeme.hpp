@@ -0,0 +1,70 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace parser::tokens
+{
+/**
+ * @brief A compact value-type token, which refers to its text instead of owning it
+ * 
+ */
+struct Lexeme
+{
+	/**
+	 * @brief The kind of the token
+	 * 
+	 */
+	enum class Kind : uint8_t
+	{
+		kWord,
+		kPunctuator,
+		kSeparator,
+		kOperator
+	};
+
+	/**
+	 * @brief The kind of the token
+	 * 
+	 */
+	Kind kind{Kind::kWord};
+
+	/**
+	 * @brief The type inside the kind (e.g. Punctuator::Type), zero for words
+	 * 
+	 */
+	uint8_t subtype{0};
+
+	/**
+	 * @brief The text of the token, usually a view into the scanned file
+	 * 
+	 */
+	std::string_view value;
+
+	/**
+	 * @brief The offset of the token from the beginning of the file
+	 * 
+	 */
+	std::size_t offset{0};
+};
+} // namespace parser::tokens
\ No newline at end of file
@@ -56,6 +56,13 @@ struct Operator : public Token
 	 */
 	std::string GetValue() const override;
 
+	/**
+	 * @brief Get the value-type representation of the token
+	 * 
+	 * @return Lexeme - the lexeme, its value is valid as long as the token lives
+	 */
+	Lexeme ToLexeme() const override;
+
 	/**
 	 * @brief Current operator's type
 	 * 
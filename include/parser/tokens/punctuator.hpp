@@ -46,7 +46,9 @@ struct Punctuator : public Token
 		kComma,
 		kSlash,
 		kBackslash,
-		kMinus
+		kMinus,
+		kAsterisk,
+		kQuestionMark
 	};
 
 	/**
@@ -63,6 +65,13 @@ struct Punctuator : public Token
 	 */
 	std::string GetValue() const override;
 
+	/**
+	 * @brief Get the value-type representation of the token
+	 * 
+	 * @return Lexeme - the lexeme, its value is valid as long as the token lives
+	 */
+	Lexeme ToLexeme() const override;
+
 	/**
 	 * @brief Current punctuator's type
 	 * 
@@ -21,6 +21,8 @@
 
 #include <string>
 
+#include "parser/tokens/lexeme.hpp"
+
 namespace parser::tokens
 {
 /**
@@ -41,5 +43,12 @@ struct Token
 	 * @return std::string - the value of the token
 	 */
 	virtual std::string GetValue() const = 0;
+
+	/**
+	 * @brief Get the value-type representation of the token
+	 * 
+	 * @return Lexeme - the lexeme, its value is valid as long as the token lives
+	 */
+	virtual Lexeme ToLexeme() const = 0;
 };
 } // namespace parser::tokens
\ No newline at end of file
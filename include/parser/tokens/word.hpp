@@ -46,6 +46,13 @@ public:
 	 */
 	std::string GetValue() const override;
 
+	/**
+	 * @brief Get the value-type representation of the token
+	 * 
+	 * @return Lexeme - the lexeme, its value is valid as long as the token lives
+	 */
+	Lexeme ToLexeme() const override;
+
 protected:
 	/**
 	 * @brief Current punctuator's type
@@ -0,0 +1,48 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+namespace scheduler::exceptions
+{
+/**
+ * @brief An exception, used to notify that the modules of the project import each other in a cycle
+ * 
+ */
+class ImportCycleException : public std::runtime_error
+{
+public:
+	/**
+	 * @brief Construct a new ImportCycleException object
+	 * 
+	 * @param module - one of the modules in the cycle
+	 */
+	explicit ImportCycleException(std::string module);
+
+protected:
+	/**
+	 * @brief The message, seeing on the exception occurence
+	 * 
+	 */
+	static const std::string kMessage;
+};
+} // namespace scheduler::exceptions
\ No newline at end of file
@@ -19,7 +19,10 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "scheduler/pipeline/pipeline.hpp"
+#include "scheduler/threadpool.hpp"
 
 namespace scheduler
 {
@@ -29,6 +32,14 @@ namespace scheduler
  */
 class Executor
 {
+public:
+	/**
+     * @brief Construct a new Executor object
+     * 
+     * @param jobs - the number of actions to run simultaneously
+     */
+	explicit Executor(std::size_t jobs = 1);
+
 public:
 	/**
      * @brief Add a new pipeline to the executor
@@ -49,5 +60,11 @@ protected:
      * 
      */
 	std::queue<pipeline::Pipeline> pipelines_{};
+
+	/**
+     * @brief The workers that run the actions of the pipelines
+     * 
+     */
+	ThreadPool pool_;
 };
 } // namespace scheduler
\ No newline at end of file
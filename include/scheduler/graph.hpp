@@ -0,0 +1,120 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include "scheduler/threadpool.hpp"
+
+namespace scheduler
+{
+/**
+ * @brief A graph of the tasks, where every task is run once all the tasks it depends on are finished
+ * 
+ */
+class Graph
+{
+public:
+	/**
+	 * @brief The ID of a node, the nodes are numbered in the order of addition
+	 * 
+	 */
+	using Id = std::size_t;
+
+public:
+	/**
+	 * @brief Add a new node to the graph
+	 * 
+	 * @param task - the task to run
+	 * @return Id - the ID of the node
+	 */
+	Id Add(std::function<void()> task);
+
+	/**
+	 * @brief Make the node wait for another node to finish
+	 * 
+	 * @param node - the ID of the node
+	 * @param dependency - the ID of the node to wait for
+	 */
+	void AddDependency(Id node, Id dependency);
+
+	/**
+	 * @brief Submit the nodes without dependencies, the rest of them are submitted by the nodes
+	 *        they depend on, so the graph must outlive ThreadPool::Wait()
+	 * 
+	 * @param pool - the workers to run the tasks on
+	 * 
+	 * @note If a task throws, the nodes that depend on it are never run
+	 */
+	void Run(ThreadPool& pool);
+
+	/**
+	 * @brief Get the number of nodes
+	 * 
+	 * @return std::size_t - the number of nodes
+	 */
+	std::size_t GetSize() const;
+
+protected:
+	/**
+	 * @brief Submit the node to the pool
+	 * 
+	 * @param pool - the workers to run the task on
+	 * @param node - the ID of the node
+	 */
+	void Submit(ThreadPool& pool, Id node);
+
+protected:
+	/**
+	 * @brief A node of the graph
+	 * 
+	 */
+	struct Node
+	{
+		/**
+		 * @brief The task to run
+		 * 
+		 */
+		std::function<void()> task;
+
+		/**
+		 * @brief The nodes, waiting for this node
+		 * 
+		 */
+		std::vector<Id> dependents{};
+
+		/**
+		 * @brief The number of the unfinished nodes this node waits for
+		 * 
+		 */
+		std::atomic<std::size_t> remaining{0};
+	};
+
+	/**
+	 * @brief The nodes, a deque is used as the nodes can't be moved
+	 * 
+	 */
+	std::deque<Node> nodes_;
+};
+} // namespace scheduler
\ No newline at end of file
@@ -0,0 +1,154 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace scheduler
+{
+/**
+ * @brief The global table of the interned paths, shared by all the pipelines
+ * 
+ * @note Every path is stored once and is identified by a 32-bit ID. The object file name and
+ *       the modification time of the path are computed once and are kept with it.
+ */
+class PathTable
+{
+public:
+	/**
+	 * @brief The identifier of an interned path
+	 * 
+	 */
+	using Id = std::uint32_t;
+
+public:
+	/**
+	 * @brief Deleted copy constructor
+	 * 
+	 */
+	PathTable(const PathTable&) = delete;
+
+	/**
+	 * @brief Deleted copy assignment operator
+	 * 
+	 */
+	PathTable& operator=(const PathTable&) = delete;
+
+public:
+	/**
+	 * @brief Get the instance of the table
+	 * 
+	 * @return PathTable& - the instance, shared by the whole application
+	 */
+	static PathTable& GetInstance();
+
+public:
+	/**
+	 * @brief Get the ID of the path, adding the path to the table if it's new
+	 * 
+	 * @param path - the path to intern
+	 * @return Id - the ID of the path
+	 */
+	Id Intern(const std::filesystem::path& path);
+
+	/**
+	 * @brief Get the interned path
+	 * 
+	 * @param id - the ID of the path
+	 * @return const std::filesystem::path& - the path, valid as long as the table lives
+	 */
+	const std::filesystem::path& GetPath(Id id) const;
+
+	/**
+	 * @brief Get the name of the object file, compiled from the path
+	 * 
+	 * @param id - the ID of the source file
+	 * @return const std::filesystem::path& - the file name with the ".o" extension
+	 */
+	const std::filesystem::path& GetObjectName(Id id);
+
+	/**
+	 * @brief Get the modification time of the path, it's only read once until reset
+	 * 
+	 * @throw std::filesystem::filesystem_error if the path doesn't exist
+	 * 
+	 * @param id - the ID of the path
+	 * @return std::filesystem::file_time_type - the modification time
+	 */
+	std::filesystem::file_time_type GetWriteTime(Id id);
+
+	/**
+	 * @brief Forget the modification times, when the files might have changed
+	 * 
+	 */
+	void ResetWriteTimes();
+
+	/**
+	 * @brief Get the number of the interned paths
+	 * 
+	 * @return std::size_t - the number of the paths
+	 */
+	std::size_t GetSize() const;
+
+protected:
+	/**
+	 * @brief Construct a new PathTable object
+	 * 
+	 */
+	PathTable() = default;
+
+protected:
+	/**
+	 * @brief An interned path with the values, derived from it
+	 * 
+	 */
+	struct Entry
+	{
+		std::filesystem::path path;
+		std::optional<std::filesystem::path> object;
+		std::optional<std::filesystem::file_time_type> time;
+	};
+
+	/**
+	 * @brief The entries by their IDs, the deque keeps them in place as it grows
+	 * 
+	 */
+	std::deque<Entry> entries_;
+
+	/**
+	 * @brief The IDs by the paths, the keys view the paths of the entries
+	 * 
+	 */
+	std::unordered_map<std::string_view, Id> ids_;
+
+	/**
+	 * @brief The mutex that guards the table
+	 * 
+	 */
+	mutable std::shared_mutex mutex_;
+};
+} // namespace scheduler
\ No newline at end of file
@@ -0,0 +1,123 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace scheduler::pipeline
+{
+/**
+ * @brief Counts the headers, included by the files of a project, to select the ones worth precompiling
+ * 
+ * @note The selection is written into a generated header, which is precompiled by the next build
+ */
+class Includes
+{
+public:
+	/**
+	 * @brief The function, that returns the preprocessed size of the header
+	 * 
+	 */
+	using Weigh = std::function<std::size_t(const std::filesystem::path&)>;
+
+public:
+	/**
+	 * @brief Construct a new Includes object
+	 * 
+	 * @param directory - the directory to keep the generated header in
+	 */
+	explicit Includes(const std::filesystem::path& directory);
+
+public:
+	/**
+	 * @brief Count the headers, included by a file
+	 * 
+	 * @param dependencies - the dependencies of the file
+	 */
+	void Add(const std::vector<std::filesystem::path>& dependencies);
+
+	/**
+	 * @brief Select the headers, included by every file of the project, and heavy enough to precompile
+	 * 
+	 * @param files - the number of the project's files
+	 * @param weigh - the function to get the preprocessed size of a header, only called for new or changed headers
+	 * @return true if the generated header was changed, false otherwise
+	 */
+	bool Update(std::size_t files, const Weigh& weigh);
+
+	/**
+	 * @brief Get the generated header
+	 * 
+	 * @return const std::filesystem::path& - the generated header, might not exist yet
+	 */
+	const std::filesystem::path& GetHeader() const;
+
+protected:
+	/**
+	 * @brief Read the sizes of the headers, measured by the previous builds
+	 * 
+	 * @return std::map<std::filesystem::path, std::size_t> - the sizes of the headers, that weren't changed since
+	 */
+	std::map<std::filesystem::path, std::size_t> ReadSizes() const;
+
+	/**
+	 * @brief Write the sizes of the headers for the next builds
+	 * 
+	 * @param sizes - the sizes of the headers
+	 */
+	void WriteSizes(const std::map<std::filesystem::path, std::size_t>& sizes) const;
+
+protected:
+	/**
+	 * @brief The generated header
+	 * 
+	 */
+	const std::filesystem::path header_;
+
+	/**
+	 * @brief The file, where the sizes of the headers are kept
+	 * 
+	 */
+	const std::filesystem::path sizes_;
+
+	/**
+	 * @brief The number of the counted files, that include every header
+	 * 
+	 */
+	std::map<std::filesystem::path, std::size_t> counts_;
+
+	/**
+	 * @brief The number of the counted files
+	 * 
+	 */
+	std::size_t files_{0};
+
+	/**
+	 * @brief The mutex, used to count the headers of the files, compiled concurrently
+	 * 
+	 */
+	std::mutex mutex_;
+};
+} // namespace scheduler::pipeline
\ No newline at end of file
@@ -33,6 +33,52 @@ namespace scheduler::pipeline
  */
 class Job
 {
+public:
+	/**
+	 * @brief A command, which is run before or after the compilation
+	 * 
+	 */
+	struct Command
+	{
+		/**
+		 * @brief The line to run in the shell
+		 * 
+		 */
+		std::string line;
+
+		/**
+		 * @brief The files the command reads, relative to the project
+		 * 
+		 */
+		std::vector<std::filesystem::path> inputs{};
+
+		/**
+		 * @brief The files the command creates, relative to the project
+		 * 
+		 * @note The command is only skipped, if it has the outputs declared
+		 * 
+		 */
+		std::vector<std::filesystem::path> outputs{};
+
+		/**
+		 * @brief If the command must wait for every command before it, and the commands after it
+		 *        must wait for it, otherwise it only waits for the commands that create it's inputs
+		 * 
+		 */
+		bool serial{false};
+
+		/**
+		 * @brief Check if the commands are the same
+		 * 
+		 * @param rhs - the command to compare with
+		 * @return true if the commands are equal, false otherwise
+		 */
+		bool operator==(const Command& rhs) const
+		{
+			return line == rhs.line && inputs == rhs.inputs && outputs == rhs.outputs && serial == rhs.serial;
+		}
+	};
+
 public:
 	/**
 	 * @brief Construct a new Job object
@@ -90,6 +136,20 @@ public:
 	 */
 	void AddFile(std::filesystem::path value);
 
+	/**
+	 * @brief Reserve the space for the files, when their number is known in advance
+	 * 
+	 * @param count - the number of files to reserve the space for
+	 */
+	void ReserveFiles(std::size_t count);
+
+	/**
+	 * @brief Replace the files of the job
+	 * 
+	 * @param value - the new files
+	 */
+	void SetFiles(std::vector<std::filesystem::path> value);
+
 	/**
 	 * @brief Get the files the job contains
 	 * 
@@ -126,33 +186,32 @@ public:
 	const std::string& GetCompilationFlags() const;
 
 	/**
-	 * @brief Set the pre-compilation command to run
+	 * @brief Set the pre-compilation commands to run
 	 * 
-	 * @param value - the command to run
+	 * @param value - the commands to run
 	 */
-	void SetPreCompilationCommands(std::vector<std::string> value);
+	void SetPreCompilationCommands(std::vector<Command> value);
 
 	/**
-	 * @brief Get the pre-compilation command
+	 * @brief Get the pre-compilation commands
 	 * 
-	 * @return const std::string& - the value of the flags
+	 * @return const std::vector<Command>& - the commands to run
 	 */
-
-	const std::vector<std::string>& GetPreCompilationCommands() const;
+	const std::vector<Command>& GetPreCompilationCommands() const;
 
 	/**
-	 * @brief Set the post-compilation command to run
+	 * @brief Set the post-compilation commands to run
 	 * 
-	 * @param value - the command to run
+	 * @param value - the commands to run
 	 */
-	void SetPostCompilationCommands(std::vector<std::string> value);
+	void SetPostCompilationCommands(std::vector<Command> value);
 
 	/**
-	 * @brief Get the post-compilation command
+	 * @brief Get the post-compilation commands
 	 * 
-	 * @return const std::string& - the value of the flags
+	 * @return const std::vector<Command>& - the commands to run
 	 */
-	const std::vector<std::string>& GetPostCompilationCommands() const;
+	const std::vector<Command>& GetPostCompilationCommands() const;
 
 	/**
 	 * @brief Add a new include directory to the job
@@ -168,6 +227,34 @@ public:
 	 */
 	const std::vector<std::filesystem::path>& GetIncludeDirectories() const;
 
+	/**
+	 * @brief Set the header to precompile
+	 * 
+	 * @param value - the header, relative to the project
+	 */
+	void SetPrecompiledHeader(std::filesystem::path value);
+
+	/**
+	 * @brief Get the header to precompile
+	 * 
+	 * @return const std::filesystem::path& - the header, empty if there's none
+	 */
+	const std::filesystem::path& GetPrecompiledHeader() const;
+
+	/**
+	 * @brief Add a new file, that is never compiled as a part of a unity file
+	 * 
+	 * @param value - the file, relative to the project
+	 */
+	void AddIsolatedFile(std::filesystem::path value);
+
+	/**
+	 * @brief Get the files, that are never compiled as a part of a unity file
+	 * 
+	 * @return const std::vector<std::filesystem::path>& - the isolated files
+	 */
+	const std::vector<std::filesystem::path>& GetIsolatedFiles() const;
+
 protected:
 	/**
 	 * @brief Job's name
@@ -203,18 +290,30 @@ protected:
 	 * @brief Pre-compilation command
 	 * 
 	 */
-	std::vector<std::string> pre_commands_;
+	std::vector<Command> pre_commands_;
 
 	/**
 	 * @brief Post-compilation command
 	 * 
 	 */
-	std::vector<std::string> post_commands_;
+	std::vector<Command> post_commands_;
 
 	/**
 	 * @brief The include directories the project has
 	 * 
 	 */
 	std::vector<std::filesystem::path> include_directories_;
+
+	/**
+	 * @brief The header, precompiled before the project's files
+	 * 
+	 */
+	std::filesystem::path precompiled_header_;
+
+	/**
+	 * @brief The files, that are never compiled as a part of a unity file
+	 * 
+	 */
+	std::vector<std::filesystem::path> isolated_files_;
 };
 } // namespace scheduler::pipeline
\ No newline at end of file
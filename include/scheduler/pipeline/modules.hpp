@@ -0,0 +1,182 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace scheduler::pipeline
+{
+/**
+ * @brief Finds the modules, the files provide and import, without running the compiler
+ * 
+ * @note Only the declarations, that start a line, are found, the conditional compilation is not taken into account.
+ *       The modules are cached by the files' modification times, the unchanged files are not read again.
+ */
+class Modules
+{
+public:
+	/**
+	 * @brief The modules of a file
+	 * 
+	 */
+	struct Unit
+	{
+		/**
+		 * @brief The module or the partition, the file is the interface of, empty if there's none
+		 * 
+		 */
+		std::string provides{};
+
+		/**
+		 * @brief The modules and the partitions, the file imports
+		 * 
+		 */
+		std::vector<std::string> imports{};
+
+		/**
+		 * @brief Whether the file is a unit of a module, so nothing can be included before it's declaration
+		 * 
+		 */
+		bool module{false};
+	};
+
+public:
+	/**
+	 * @brief Construct a new Modules object, loading the cached modules of the files
+	 * 
+	 * @param cache - the path to the file the modules are cached in
+	 */
+	explicit Modules(std::filesystem::path cache);
+
+public:
+	/**
+	 * @brief Get the modules of the file, scanning it only if it has changed
+	 * 
+	 * @param file - the file to scan
+	 * @return Unit - the modules of the file, empty if it can't be read
+	 */
+	Unit Find(const std::filesystem::path& file);
+
+	/**
+	 * @brief Save the modules of the files, found since the cache was loaded, if any of them have changed
+	 * 
+	 */
+	void Save();
+
+	/**
+	 * @brief Find the modules of the file
+	 * 
+	 * @param file - the file to scan
+	 * @return Unit - the modules of the file, empty if it can't be read
+	 */
+	static Unit Scan(const std::filesystem::path& file);
+
+	/**
+	 * @brief Find the modules of the source
+	 * 
+	 * @param source - the contents of a file
+	 * @return Unit - the modules of the source
+	 */
+	static Unit Parse(std::string_view source);
+
+protected:
+	/**
+	 * @brief The cached modules of a file
+	 * 
+	 */
+	struct Entry
+	{
+		/**
+		 * @brief The modification time of the file, when it was scanned
+		 * 
+		 */
+		std::int64_t time{0};
+
+		/**
+		 * @brief The modules of the file
+		 * 
+		 */
+		Unit unit{};
+	};
+
+protected:
+	/**
+	 * @brief Load the cached modules of the files
+	 * 
+	 */
+	void Load();
+
+	/**
+	 * @brief Remove the comments and the literals from the line
+	 * 
+	 * @param line - the line to clean
+	 * @param comment - whether the line starts inside a multi-line comment, updated for the next line
+	 * @return std::string - the code of the line
+	 */
+	static std::string Strip(std::string_view line, bool& comment);
+
+	/**
+	 * @brief Remove the word from the beginning of the statement
+	 * 
+	 * @param statement - the statement to check
+	 * @param word - the word to look for
+	 * @return true if the statement started with the word, false otherwise
+	 */
+	static bool Consume(std::string_view& statement, std::string_view word);
+
+	/**
+	 * @brief Get the name of the module, the rest of the statement declares or imports
+	 * 
+	 * @param statement - the statement after the keyword
+	 * @return std::string - the name, empty if the statement is not a declaration of a named module
+	 */
+	static std::string GetName(std::string_view statement);
+
+protected:
+	/**
+	 * @brief The path to the file the modules are cached in
+	 * 
+	 */
+	std::filesystem::path cache_;
+
+	/**
+	 * @brief The modules of the files, loaded from the cache, by the files' paths
+	 * 
+	 */
+	std::map<std::string, Entry> cached_;
+
+	/**
+	 * @brief The modules of the files, found since the cache was loaded, by the files' paths
+	 * 
+	 */
+	std::map<std::string, Entry> found_;
+
+	/**
+	 * @brief Whether any of the files have been scanned since the cache was loaded
+	 * 
+	 */
+	bool changed_{false};
+};
+} // namespace scheduler::pipeline
\ No newline at end of file
@@ -19,11 +19,19 @@
 
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
+#include <optional>
 #include <queue>
 
+#include "scheduler/graph.hpp"
+#include "scheduler/pathtable.hpp"
+#include "scheduler/pipeline/includes.hpp"
 #include "scheduler/pipeline/job.hpp"
+#include "scheduler/pipeline/modules.hpp"
+#include "scheduler/threadpool.hpp"
 #include "sys/tools/compiler.hpp"
+#include "utils/logger.hpp"
 
 namespace scheduler::pipeline
 {
@@ -38,8 +46,9 @@ public:
 	 * @brief Construct a new Pipeline object
 	 * 
 	 * @param job - the associated job
+	 * @param unity - true if the files are grouped into the unity files, false otherwise
 	 */
-	Pipeline(Job job);
+	Pipeline(Job job, bool unity = false);
 
 	/**
 	 * @brief Construct a new Pipeline object
@@ -65,29 +74,107 @@ public:
 	/**
 	 * @brief Run the pipeline
 	 * 
+	 * @param pool - the workers to run the compilation on
 	 */
-	void Run() const;
+	void Run(ThreadPool& pool) const;
 
 protected:
 	/**
-	 * @brief Run the compilation for the given files
+	 * @brief Add the compilation of the file to the graph
+	 * 
+	 * @param graph - the graph of the build
+	 * @param source - the ID of the file to compile
+	 * @param obj - the object file to compile the file into
+	 * @param precompiled - the precompiled header, empty if there's none
+	 * @param unit - the modules, the file provides and imports
+	 * @return Graph::Id - the node that compiles the file
+	 */
+	Graph::Id Compile(Graph& graph, PathTable::Id source, std::filesystem::path obj,
+					  std::filesystem::path precompiled, Modules::Unit unit) const;
+
+	/**
+	 * @brief Make the files wait for the interfaces of the modules they import, and tell the compiler where they are
+	 * 
+	 * @param graph - the graph of the build
+	 * @param nodes - the nodes that compile the files
+	 * @param units - the modules of the files
+	 */
+	void AddModules(Graph& graph, const std::vector<Graph::Id>& nodes, const std::vector<Modules::Unit>& units) const;
+
+	/**
+	 * @brief Get the path to the compiled interface of the module, it's kept between the builds
+	 * 
+	 * @param module - the name of the module or the partition
+	 * @return std::filesystem::path - the absolute path to the interface
+	 */
+	std::filesystem::path GetInterfacePath(const std::string& module) const;
+
+	/**
+	 * @brief Group the files into the unity files, the generated, isolated and modular files are compiled separately
+	 * 
+	 * @param files - the files of the project, replaced with the files to compile
+	 * @param producers - the commands, that create the files, replaced along with them
+	 * @param units - the modules of the files, replaced along with them
+	 * @param workers - the number of the files, compiled simultaneously
+	 */
+	void Group(std::vector<std::filesystem::path>& files, std::vector<std::optional<Graph::Id>>& producers,
+			   std::vector<Modules::Unit>& units, std::size_t workers) const;
+
+	/**
+	 * @brief Add the precompilation of the header to the graph
+	 * 
+	 * @param graph - the graph of the build
+	 * @param header - the header to precompile
+	 * @param wrapper - the header, that includes it and is included into the files
+	 * @return Graph::Id - the node that precompiles the header
+	 */
+	Graph::Id Precompile(Graph& graph, std::filesystem::path header, std::filesystem::path wrapper) const;
+
+	/**
+	 * @brief Get the header to precompile, either the project's one or the selected automatically
+	 * 
+	 * @return std::filesystem::path - the header, empty if there's none
+	 */
+	std::filesystem::path GetPrecompiledHeader() const;
+
+	/**
+	 * @brief Get the path to the wrapper of the header, the header is precompiled next to it
 	 * 
 	 * @param folder - the folder where to store the output
-	 * @param files - a vector of files
-	 * @return std::vector<std::filesystem::path> - a vector of object files names
+	 * @param header - the header to precompile
+	 * @return std::filesystem::path - the path to the wrapper
+	 */
+	std::filesystem::path GetWrapperPath(const std::filesystem::path& folder,
+										 const std::filesystem::path& header) const;
+
+	/**
+	 * @brief Select the headers to precompile by the next build, from the headers counted by this one
+	 * 
+	 * @param files - the number of the project's files
+	 */
+	void SelectHeaders(std::size_t files) const;
+
+	/**
+	 * @brief Check if the file is newer than the object file
+	 * 
+	 * @param file - the file to check, might be empty
+	 * @param obj - the object file
+	 * @return true if the file exists and is newer, false otherwise
 	 */
-	std::vector<std::filesystem::path> Compile(const std::filesystem::path& folder,
-											   std::vector<std::filesystem::path> files) const;
+	static bool IsNewer(const std::filesystem::path& file, const std::filesystem::path& obj);
 
 	/**
 	 * @brief Check if the object file is already compiled
 	 * 
-	 * @param file - the file to check
-	 * @param folder - the output folder of the program
+	 * @param file - the ID of the file to check
+	 * @param obj - the object file, compiled from the file
+	 * @param listener - the function to pass the diagnostics of the compiler to
+	 * @param includes - the counter of the headers, the file includes, might be nullptr
 	 * @return true if the file has the newest object file compiled for it
 	 * @return false otherwise
 	 */
-	bool IsCompiled(const std::filesystem::path& file, const std::filesystem::path& folder) const;
+	bool IsCompiled(PathTable::Id file, const std::filesystem::path& obj,
+					const sys::Command::Listener& listener, Includes* includes) const;
 
 	/**
 	 * @brief Link everything into one executable
@@ -98,16 +185,57 @@ protected:
 	void Link(const std::filesystem::path& folder, std::vector<std::filesystem::path> files) const;
 
 	/**
-	 * @brief Execute preprocessing commands
+	 * @brief Execute the command, unless it's outputs are up to date
+	 * 
+	 * @param command - the command to execute
+	 * @return true if the command succeeded or was skipped, false otherwise
+	 */
+	bool Execute(const Job::Command& command) const;
+
+	/**
+	 * @brief Check if the outputs of the command are newer than it's inputs, and were
+	 *        created by the same command
+	 * 
+	 * @param command - the command to check
+	 * @return true if the command can be skipped, false otherwise
+	 */
+	bool IsUpToDate(const Job::Command& command) const;
+
+	/**
+	 * @brief Get the path to the stamp of the command, the command is identified by it's outputs
+	 * 
+	 * @param command - the command to get the stamp for
+	 * @return std::filesystem::path - the path to the stamp
+	 */
+	std::filesystem::path GetStampPath(const Job::Command& command) const;
+
+	/**
+	 * @brief Hash the line and the inputs of the command, the stamp is only valid for the same hash
+	 * 
+	 * @param command - the command to hash
+	 * @return std::uint64_t - the hash
+	 */
+	static std::uint64_t Hash(const Job::Command& command);
+
+	/**
+	 * @brief Add the commands to the graph, every command waits for the commands it depends on
 	 * 
+	 * @tparam Exception - the exception to throw, if a command fails
+	 * @param graph - the graph of the build
+	 * @param commands - the commands to add
+	 * @return std::vector<Graph::Id> - the nodes of the commands, in the same order
 	 */
-	void ExecutePreprocessingCommands() const;
+	template<typename Exception>
+	std::vector<Graph::Id> AddCommands(Graph& graph, const std::vector<Job::Command>& commands) const;
 
 	/**
-	 * @brief Execute postprocessing commands
+	 * @brief Check if the command must wait for the previous one, as they share the files
 	 * 
+	 * @param command - the command to check
+	 * @param previous - the command, that goes before it in the list
+	 * @return true if the command uses the files of the previous one, false otherwise
 	 */
-	void ExecutePostprocessingCommands() const;
+	static bool IsDependent(const Job::Command& command, const Job::Command& previous);
 
 protected:
 	/**
@@ -121,5 +249,23 @@ protected:
 	 * 
 	 */
 	std::unique_ptr<sys::tools::Compiler> compiler_;
+
+	/**
+	 * @brief The counter of the headers, used if the headers to precompile are selected automatically
+	 * 
+	 */
+	std::unique_ptr<Includes> includes_;
+
+	/**
+	 * @brief Whether the files are grouped into the unity files
+	 * 
+	 */
+	bool unity_;
+
+	/**
+	 * @brief The logger of the build events
+	 * 
+	 */
+	utils::Logger logger_;
 };
 } // namespace scheduler::pipeline
\ No newline at end of file
@@ -0,0 +1,99 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace scheduler::pipeline
+{
+/**
+ * @brief Groups the files of a project into the unity files, so the headers they share are parsed once per batch
+ * 
+ * @note The batches are balanced by the size of the sources, the boundaries between them are picked by the names
+ *       and the sizes of the files, so an added, removed or edited file only changes it's own batch
+ */
+class Unity
+{
+public:
+	/**
+	 * @brief Construct a new Unity object
+	 * 
+	 * @param directory - the directory to keep the unity files in
+	 * @param root - the directory of the project, the files are identified by their paths in it
+	 */
+	Unity(std::filesystem::path directory, std::filesystem::path root);
+
+public:
+	/**
+	 * @brief Group the files into the batches, writing a unity file for every batch of more than one file
+	 * 
+	 * @param files - the files to group
+	 * @param workers - the number of the files, compiled simultaneously
+	 * @return std::vector<std::filesystem::path> - the files to compile instead, either unity or the given ones
+	 */
+	std::vector<std::filesystem::path> Group(std::vector<std::filesystem::path> files, std::size_t workers) const;
+
+protected:
+	/**
+	 * @brief Split the files into the batches
+	 * 
+	 * @param files - the sorted files
+	 * @param costs - the costs of the files
+	 * @param target - the cost of a batch to aim for
+	 * @return std::vector<std::size_t> - the index of the first file of every batch
+	 */
+	std::vector<std::size_t> Split(const std::vector<std::filesystem::path>& files,
+								   const std::vector<std::uintmax_t>& costs, std::uintmax_t target) const;
+
+	/**
+	 * @brief Hash the path of the file in the project
+	 * 
+	 * @param file - the file to hash
+	 * @return std::uint64_t - the hash
+	 */
+	std::uint64_t GetHash(const std::filesystem::path& file) const;
+
+	/**
+	 * @brief Write the unity file of the batch, unless it's already the same
+	 * 
+	 * @param begin - the first file of the batch
+	 * @param end - the file after the last one of the batch
+	 * @return std::filesystem::path - the unity file
+	 */
+	std::filesystem::path Write(std::vector<std::filesystem::path>::const_iterator begin,
+								std::vector<std::filesystem::path>::const_iterator end) const;
+
+protected:
+	/**
+	 * @brief The directory to keep the unity files in
+	 * 
+	 */
+	const std::filesystem::path directory_;
+
+	/**
+	 * @brief The directory of the project
+	 * 
+	 */
+	const std::filesystem::path root_;
+};
+} // namespace scheduler::pipeline
\ No newline at end of file
@@ -0,0 +1,145 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace scheduler
+{
+/**
+ * @brief A fixed-size pool of workers that run the submitted tasks
+ * 
+ */
+class ThreadPool
+{
+public:
+	/**
+	 * @brief Construct a new ThreadPool object
+	 * 
+	 * @param size - the number of workers (at least one worker is always started)
+	 */
+	explicit ThreadPool(std::size_t size);
+
+	/**
+	 * @brief Destroy the ThreadPool object, waiting for the workers to finish
+	 * 
+	 */
+	~ThreadPool();
+
+	/**
+	 * @brief Deleted copy constructor of a new ThreadPool object
+	 * 
+	 */
+	ThreadPool(const ThreadPool&) = delete;
+
+	/**
+	 * @brief Deleted copy assignment operator
+	 * 
+	 * @return const ThreadPool& - another instance of the pool
+	 */
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+public:
+	/**
+	 * @brief Add a new task to the queue
+	 * 
+	 * @param task - the task to run on one of the workers
+	 */
+	void Submit(std::function<void()> task);
+
+	/**
+	 * @brief Wait until all the submitted tasks are finished
+	 * 
+	 * @note If any of the tasks has thrown an exception, the rest of the queue is dropped
+	 *       and the first exception is rethrown here
+	 */
+	void Wait();
+
+	/**
+	 * @brief Get the number of workers
+	 * 
+	 * @return std::size_t - the number of workers
+	 */
+	std::size_t GetSize() const;
+
+protected:
+	/**
+	 * @brief The loop, run by every worker
+	 * 
+	 */
+	void Work();
+
+protected:
+	/**
+	 * @brief The workers
+	 * 
+	 */
+	std::vector<std::thread> workers_;
+
+	/**
+	 * @brief The queue of tasks to run
+	 * 
+	 */
+	std::queue<std::function<void()>> tasks_;
+
+	/**
+	 * @brief The mutex that guards the queue and the state of the pool
+	 * 
+	 */
+	std::mutex mutex_;
+
+	/**
+	 * @brief The condition, used to notify the workers about new tasks
+	 * 
+	 */
+	std::condition_variable available_;
+
+	/**
+	 * @brief The condition, used to notify the waiters about finished tasks
+	 * 
+	 */
+	std::condition_variable finished_;
+
+	/**
+	 * @brief The number of tasks that are either queued or running
+	 * 
+	 */
+	std::size_t pending_{0};
+
+	/**
+	 * @brief The first exception, thrown by a task
+	 * 
+	 */
+	std::exception_ptr exception_;
+
+	/**
+	 * @brief The flag, used to stop the workers
+	 * 
+	 */
+	bool stopping_{false};
+};
+} // namespace scheduler
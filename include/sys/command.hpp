@@ -19,6 +19,13 @@
 
 #pragma once
 
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "sys/usage.hpp"
+
 namespace sys
 {
 /**
@@ -27,6 +34,13 @@ namespace sys
  */
 class Command
 {
+public:
+	/**
+	 * @brief The function, which receives the diagnostics of the command as they are read
+	 * 
+	 */
+	using Listener = std::function<void(std::string_view)>;
+
 public:
 	/**
      * @brief Execute the command
@@ -41,5 +55,30 @@ public:
       * @return std::string - the output from the command
       */
 	virtual std::string GetOutput() const = 0;
+
+	/**
+      * @brief Set the function to pass the error output of the command to
+      * 
+      * @note If no listener is set, the error output goes straight to the terminal
+      * 
+      * @param listener - the function to call with every piece of the error output
+      */
+	virtual void SetListener(Listener listener) = 0;
+
+	/**
+      * @brief Set the directory to run the command in
+      * 
+      * @note If no directory is set, the command runs in the current working directory
+      * 
+      * @param directory - the working directory of the command
+      */
+	virtual void SetDirectory(std::filesystem::path directory) = 0;
+
+	/**
+      * @brief Get the resources the command consumed during the last execution
+      * 
+      * @return Usage - the resource usage of the command
+      */
+	virtual Usage GetUsage() const = 0;
 };
 } // namespace sys
\ No newline at end of file
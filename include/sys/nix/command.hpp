@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <filesystem>
 #include <string>
 
 #include "sys/command.hpp"
@@ -62,6 +63,27 @@ public:
       */
 	std::string GetOutput() const override;
 
+	/**
+      * @brief Set the function to pass the error output of the command to
+      * 
+      * @param listener - the function to call with every piece of the error output
+      */
+	void SetListener(Listener listener) override;
+
+	/**
+      * @brief Set the directory to run the command in
+      * 
+      * @param directory - the working directory of the command
+      */
+	void SetDirectory(std::filesystem::path directory) override;
+
+	/**
+      * @brief Get the resources the command consumed during the last execution
+      * 
+      * @return Usage - the resource usage of the command, collected with wait4()
+      */
+	Usage GetUsage() const override;
+
 protected:
 	/**
      * @brief The command
@@ -74,5 +96,23 @@ protected:
       * 
       */
 	std::string output_;
+
+	/**
+      * @brief The function the error output is passed to
+      * 
+      */
+	Listener listener_;
+
+	/**
+      * @brief The working directory of the command, empty for the current one
+      * 
+      */
+	std::filesystem::path directory_;
+
+	/**
+      * @brief Command's resource usage
+      * 
+      */
+	Usage usage_;
 };
 } // namespace sys::nix
\ No newline at end of file
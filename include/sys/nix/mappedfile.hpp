@@ -0,0 +1,81 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <string_view>
+
+namespace sys::nix
+{
+/**
+ * @brief A read-only memory mapping of a whole file
+ * 
+ */
+class MappedFile
+{
+public:
+	/**
+     * @brief Construct a new MappedFile object
+     * 
+     * @param path - the path to the file to map
+     */
+	explicit MappedFile(const std::filesystem::path& path);
+
+	/**
+     * @brief Destroy the MappedFile object
+     * 
+     */
+	~MappedFile();
+
+	/**
+     * @brief Deleted copy constructor, the mapping is owned by a single object
+     * 
+     */
+	MappedFile(const MappedFile&) = delete;
+
+	/**
+     * @brief Deleted copy assignment operator, the mapping is owned by a single object
+     * 
+     * @return MappedFile& - another instance of the mapped file
+     */
+	MappedFile& operator=(const MappedFile&) = delete;
+
+public:
+	/**
+      * @brief Get the contents of the file
+      * 
+      * @return std::string_view - a view into the mapping, valid as long as the object lives
+      */
+	std::string_view GetData() const;
+
+protected:
+	/**
+     * @brief The beginning of the mapping
+     * 
+     */
+	void* data_{nullptr};
+
+	/**
+     * @brief The size of the mapping
+     * 
+     */
+	std::size_t size_{0};
+};
+} // namespace sys::nix
\ No newline at end of file
@@ -23,6 +23,8 @@
 #include <string>
 #include <vector>
 
+#include "sys/command.hpp"
+
 namespace sys::tools
 {
 /**
@@ -31,21 +33,88 @@ namespace sys::tools
  */
 struct Compiler
 {
+	/**
+	 * @brief Destroy the Compiler object
+	 * 
+	 */
+	virtual ~Compiler() = default;
+
 	/**
 	 * @brief Compile the given file
 	 * 
 	 * @param file - the file to compile
 	 * @param out - the file where to store the output
+	 * @param listener - the function to pass the diagnostics of the compiler to
 	 */
-	virtual void Compile(const std::filesystem::path& file, const std::filesystem::path& out) = 0;
+	virtual void Compile(const std::filesystem::path& file, const std::filesystem::path& out,
+						 const Command::Listener& listener) = 0;
+
+	/**
+	 * @brief Compile the given unit of a module, writing the interface of the module, if it provides one
+	 * 
+	 * @param file - the file to compile
+	 * @param out - the file where to store the output
+	 * @param listener - the function to pass the diagnostics of the compiler to
+	 * 
+	 * @note The precompiled header is not included, as nothing can precede the declaration of the module
+	 */
+	virtual void CompileModule(const std::filesystem::path& file, const std::filesystem::path& out,
+							   const Command::Listener& listener) = 0;
+
+	/**
+	 * @brief Precompile the given header
+	 * 
+	 * @param header - the header to precompile
+	 * @param out - the file where to store the precompiled header
+	 * @param listener - the function to pass the diagnostics of the compiler to
+	 */
+	virtual void Precompile(const std::filesystem::path& header, const std::filesystem::path& out,
+							const Command::Listener& listener) = 0;
+
+	/**
+	 * @brief Include the header into every file, compiled after this call, using it's precompiled version
+	 * 
+	 * @param header - the header, precompiled by Precompile()
+	 * 
+	 * @note The header is not reported by GetDependencies(), so it only reflects the files' own includes
+	 */
+	virtual void SetPrecompiledHeader(const std::filesystem::path& header) = 0;
+
+	/**
+	 * @brief Find the interfaces of the modules, imported by the files compiled after this call, through the mapper
+	 * 
+	 * @param mapper - the file with a line per module, the name of the module and the path to it's interface
+	 */
+	virtual void SetModuleMapper(const std::filesystem::path& mapper) = 0;
 
 	/**
 	 * @brief Get the dependencies of the file
 	 * 
 	 * @param file - the file to inspect
+	 * @param listener - the function to pass the diagnostics of the compiler to
 	 * @return std::vector<std::filesystem::path> - a vector of dependencies
 	 */
 	virtual std::vector<std::filesystem::path>
-	GetDependencies(const std::filesystem::path& file) const = 0;
+	GetDependencies(const std::filesystem::path& file, const Command::Listener& listener) const = 0;
+
+	/**
+	 * @brief Preprocess the given file
+	 * 
+	 * @param file - the file to preprocess
+	 * @param listener - the function to pass the diagnostics of the compiler to
+	 * @return std::string - the preprocessed file
+	 */
+	virtual std::string Preprocess(const std::filesystem::path& file, const Command::Listener& listener) const = 0;
+
+	/**
+	 * @brief Link the given object files into an executable
+	 * 
+	 * @param files - the object files to link
+	 * @param out - the executable to create
+	 * @param listener - the function to pass the diagnostics of the compiler to
+	 * @return true if the files were linked successfully, false otherwise
+	 */
+	virtual bool Link(const std::vector<std::filesystem::path>& files,
+					  const std::filesystem::path& out, const Command::Listener& listener) = 0;
 };
 } // namespace sys::tools
\ No newline at end of file
@@ -19,7 +19,10 @@
 
 #pragma once
 
+#include <functional>
+#include <map>
 #include <memory>
+#include <string>
 
 #include "sys/tools/compiler.hpp"
 
@@ -31,6 +34,14 @@ namespace sys::tools
  */
 class CompilerFactory
 {
+public:
+	/**
+     * @brief The function that creates an instance of a compiler
+     * 
+     */
+	using Creator = std::function<std::unique_ptr<Compiler>(
+		std::string flags, std::vector<std::filesystem::path> include_directories)>;
+
 public:
 	/**
      * @brief Create the given compiler
@@ -43,5 +54,23 @@ public:
 	static std::unique_ptr<Compiler> Create(const std::string& value,
 											std::string flags,
 											std::vector<std::filesystem::path> include_directories);
+
+	/**
+     * @brief Register a compiler, so it can be created by it's name
+     * 
+     * @note The registered compilers take precedence over the built-in ones
+     * 
+     * @param value - the name of the compiler
+     * @param creator - the function that creates the compiler
+     */
+	static void Register(const std::string& value, Creator creator);
+
+protected:
+	/**
+     * @brief Get the registered compilers
+     * 
+     * @return std::map<std::string, Creator>& - the compilers, mapped by their names
+     */
+	static std::map<std::string, Creator>& GetRegistry();
 };
 } // namespace sys::tools
\ No newline at end of file
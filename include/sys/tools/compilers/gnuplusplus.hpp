@@ -48,17 +48,74 @@ public:
 	 * 
 	 * @param file - the file to compile
 	 * @param out - the file where to store the output
+	 * @param listener - the function to pass the diagnostics of the compiler to
 	 */
-	void Compile(const std::filesystem::path& file, const std::filesystem::path& out) override;
+	void Compile(const std::filesystem::path& file, const std::filesystem::path& out,
+				 const Command::Listener& listener) override;
+
+	/**
+	 * @brief Compile the given unit of a module, writing the interface of the module, if it provides one
+	 * 
+	 * @param file - the file to compile
+	 * @param out - the file where to store the output
+	 * @param listener - the function to pass the diagnostics of the compiler to
+	 */
+	void CompileModule(const std::filesystem::path& file, const std::filesystem::path& out,
+					   const Command::Listener& listener) override;
+
+	/**
+	 * @brief Precompile the given header
+	 * 
+	 * @param header - the header to precompile
+	 * @param out - the file where to store the precompiled header
+	 * @param listener - the function to pass the diagnostics of the compiler to
+	 */
+	void Precompile(const std::filesystem::path& header, const std::filesystem::path& out,
+					const Command::Listener& listener) override;
+
+	/**
+	 * @brief Include the header into every file, compiled after this call, using it's precompiled version
+	 * 
+	 * @param header - the header, precompiled by Precompile()
+	 */
+	void SetPrecompiledHeader(const std::filesystem::path& header) override;
+
+	/**
+	 * @brief Find the interfaces of the modules, imported by the files compiled after this call, through the mapper
+	 * 
+	 * @param mapper - the file with a line per module, the name of the module and the path to it's interface
+	 */
+	void SetModuleMapper(const std::filesystem::path& mapper) override;
 
 	/**
 	 * @brief Get the dependencies of the file
 	 * 
 	 * @param file - the file to inspect
+	 * @param listener - the function to pass the diagnostics of the compiler to
 	 * @return std::vector<std::filesystem::path> - a vector of dependencies
 	 */
 	std::vector<std::filesystem::path>
-	GetDependencies(const std::filesystem::path& file) const override;
+	GetDependencies(const std::filesystem::path& file, const Command::Listener& listener) const override;
+
+	/**
+	 * @brief Preprocess the given file
+	 * 
+	 * @param file - the file to preprocess
+	 * @param listener - the function to pass the diagnostics of the compiler to
+	 * @return std::string - the preprocessed file
+	 */
+	std::string Preprocess(const std::filesystem::path& file, const Command::Listener& listener) const override;
+
+	/**
+	 * @brief Link the given object files into an executable
+	 * 
+	 * @param files - the object files to link
+	 * @param out - the executable to create
+	 * @param listener - the function to pass the diagnostics of the compiler to
+	 * @return true if the files were linked successfully, false otherwise
+	 */
+	bool Link(const std::vector<std::filesystem::path>& files, const std::filesystem::path& out,
+			  const Command::Listener& listener) override;
 
 public:
 	/**
@@ -89,5 +146,17 @@ protected:
 	 * 
 	 */
 	const std::vector<std::filesystem::path> kDirectories;
+
+	/**
+	 * @brief The header, included into every file, empty if there's none
+	 * 
+	 */
+	std::filesystem::path header_;
+
+	/**
+	 * @brief The mapper of the modules to their interfaces, empty if the modules are not used
+	 * 
+	 */
+	std::filesystem::path mapper_;
 };
 } // namespace sys::tools::compilers
\ No newline at end of file
@@ -0,0 +1,75 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace sys
+{
+/**
+ * @brief The resources consumed by a finished system command
+ * 
+ */
+struct Usage
+{
+	/**
+	 * @brief The time spent executing in user mode
+	 * 
+	 */
+	std::chrono::microseconds user_time{0};
+
+	/**
+	 * @brief The time spent executing in kernel mode
+	 * 
+	 */
+	std::chrono::microseconds system_time{0};
+
+	/**
+	 * @brief The maximum resident set size (in kilobytes)
+	 * 
+	 */
+	std::int64_t max_resident_set_size{0};
+
+	/**
+	 * @brief The number of times the process gave up the CPU voluntarily
+	 * 
+	 */
+	std::int64_t voluntary_context_switches{0};
+
+	/**
+	 * @brief The number of times the process was preempted
+	 * 
+	 */
+	std::int64_t involuntary_context_switches{0};
+
+	/**
+	 * @brief The number of block input operations
+	 * 
+	 */
+	std::int64_t block_input_operations{0};
+
+	/**
+	 * @brief The number of block output operations
+	 * 
+	 */
+	std::int64_t block_output_operations{0};
+};
+} // namespace sys
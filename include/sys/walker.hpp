@@ -0,0 +1,164 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "scheduler/threadpool.hpp"
+
+namespace sys
+{
+/**
+ * @brief A parallel directory walker, used to expand glob patterns
+ * 
+ * @note Directory listings are cached by the directory's modification time, a directory that
+ *       hasn't changed since it was listed is not read again. The cache is kept between runs.
+ */
+class Walker
+{
+public:
+	/**
+	 * @brief Construct a new Walker object, loading the cached listings
+	 * 
+	 * @param cache - the path to the file the listings are cached in
+	 * @param jobs - the number of directories to list simultaneously
+	 */
+	Walker(std::filesystem::path cache, std::size_t jobs);
+
+public:
+	/**
+	 * @brief Find the files that match the glob pattern
+	 * 
+	 * @note "*", "?" and "[...]" match within a single path component, "**" matches any
+	 *       number of directories. Hidden files and directories are only matched explicitly.
+	 * 
+	 * @param root - the directory the pattern is relative to
+	 * @param pattern - the pattern to match
+	 * @return std::vector<std::filesystem::path> - the sorted paths, relative to the root
+	 */
+	std::vector<std::filesystem::path> Glob(const std::filesystem::path& root, std::string_view pattern);
+
+	/**
+	 * @brief Save the cached listings, if any of them have changed
+	 * 
+	 */
+	void Save();
+
+	/**
+	 * @brief Check if the value contains any wildcards
+	 * 
+	 * @param value - the value to check
+	 * @return true if the value is a glob pattern, false otherwise
+	 */
+	static bool IsPattern(std::string_view value);
+
+protected:
+	/**
+	 * @brief The contents of a directory
+	 * 
+	 */
+	struct Listing
+	{
+		std::int64_t time{0};
+		std::vector<std::string> files;
+		std::vector<std::string> directories;
+	};
+
+	/**
+	 * @brief List the files of the directory tree, a level of directories at a time
+	 * 
+	 * @param base - the directory to walk
+	 * @param depth - the number of directory levels to descend into
+	 * @return std::vector<std::filesystem::path> - the files, relative to the base
+	 */
+	std::vector<std::filesystem::path> Walk(const std::filesystem::path& base, std::size_t depth);
+
+	/**
+	 * @brief Get the contents of the directory, reading it only if it has changed
+	 * 
+	 * @param directory - the directory to list
+	 * @return std::shared_ptr<const Listing> - the contents of the directory
+	 */
+	std::shared_ptr<const Listing> GetListing(const std::filesystem::path& directory);
+
+	/**
+	 * @brief Load the cached listings
+	 * 
+	 */
+	void Load();
+
+	/**
+	 * @brief Match the components of the path against the components of the pattern
+	 * 
+	 * @param pattern - the components of the pattern
+	 * @param path - the components of the path
+	 * @return true if the path matches the pattern, false otherwise
+	 */
+	static bool Match(const std::string_view* pattern, const std::string_view* pattern_end,
+					  const std::string_view* path, const std::string_view* path_end);
+
+	/**
+	 * @brief Split the path into it's components, skipping the empty ones
+	 * 
+	 * @param value - the path to split
+	 * @return std::vector<std::string_view> - the components
+	 */
+	static std::vector<std::string_view> Split(std::string_view value);
+
+protected:
+	/**
+	 * @brief The path to the file the listings are cached in
+	 * 
+	 */
+	std::filesystem::path cache_;
+
+	/**
+	 * @brief The cached listings by the directories' paths
+	 * 
+	 */
+	std::map<std::string, std::shared_ptr<const Listing>> listings_;
+
+	/**
+	 * @brief The mutex that guards the cached listings
+	 * 
+	 */
+	std::mutex mutex_;
+
+	/**
+	 * @brief Whether any of the listings have changed since they were loaded
+	 * 
+	 */
+	bool changed_{false};
+
+	/**
+	 * @brief The workers that list the directories
+	 * 
+	 */
+	scheduler::ThreadPool pool_;
+};
+} // namespace sys
\ No newline at end of file
@@ -0,0 +1,222 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace utils::binary
+{
+/**
+ * @brief Append the integer value to the buffer
+ * 
+ * @param buffer - the buffer to append to
+ * @param value - the value to append
+ */
+template<typename T>
+void Write(std::string& buffer, T value)
+{
+	buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/**
+ * @brief Append the length-prefixed string to the buffer
+ * 
+ * @param buffer - the buffer to append to
+ * @param value - the value to append
+ */
+inline void Write(std::string& buffer, std::string_view value)
+{
+	Write(buffer, static_cast<std::uint32_t>(value.size()));
+	buffer.append(value);
+}
+
+/**
+ * @brief Append the count-prefixed list of strings or paths to the buffer
+ * 
+ * @param buffer - the buffer to append to
+ * @param values - the values to append
+ */
+template<typename T>
+void Write(std::string& buffer, const std::vector<T>& values)
+{
+	Write(buffer, static_cast<std::uint32_t>(values.size()));
+	for(const auto& value : values)
+	{
+		if constexpr(std::is_same_v<T, std::filesystem::path>)
+		{
+			Write(buffer, std::string_view{value.native()});
+		}
+		else
+		{
+			Write(buffer, std::string_view{value});
+		}
+	}
+}
+
+/**
+ * @brief Hash the given data with 64-bit FNV-1a
+ * 
+ * @param data - the data to hash
+ * @return std::uint64_t - the hash
+ */
+inline std::uint64_t Hash(std::string_view data)
+{
+	std::uint64_t hash{0xcbf29ce484222325};
+	for(const auto character : data)
+	{
+		hash ^= static_cast<unsigned char>(character);
+		hash *= 0x100000001b3;
+	}
+
+	return hash;
+}
+
+/**
+ * @brief A bounds-checked reader of the data, written by Write()
+ * 
+ */
+class Reader
+{
+public:
+	/**
+	 * @brief Construct a new Reader object
+	 * 
+	 * @param data - the data to read
+	 */
+	explicit Reader(std::string_view data)
+		: data_{data}
+	{}
+
+public:
+	/**
+	 * @brief Read the integer value
+	 * 
+	 * @return T - the value or zero, if there is not enough data
+	 */
+	template<typename T>
+	T Read()
+	{
+		T value{};
+		if(data_.size() < sizeof(value))
+		{
+			failed_ = true;
+			return value;
+		}
+
+		std::memcpy(&value, data_.data(), sizeof(value));
+		data_.remove_prefix(sizeof(value));
+		return value;
+	}
+
+	/**
+	 * @brief Read the length-prefixed string
+	 * 
+	 * @return std::string_view - a view into the data or an empty view, if there is not enough data
+	 */
+	std::string_view ReadString()
+	{
+		const auto size = Read<std::uint32_t>();
+		if(data_.size() < size)
+		{
+			failed_ = true;
+			return {};
+		}
+
+		const auto value = data_.substr(0, size);
+		data_.remove_prefix(size);
+		return value;
+	}
+
+	/**
+	 * @brief Read the number of strings in a list
+	 * 
+	 * @return std::uint32_t - the number of strings or zero, if the data can't hold them all
+	 */
+	std::uint32_t ReadCount()
+	{
+		// Every string takes at least the bytes of it's length
+		const auto count = Read<std::uint32_t>();
+		if(data_.size() / sizeof(std::uint32_t) < count)
+		{
+			failed_ = true;
+			return 0;
+		}
+
+		return count;
+	}
+
+	/**
+	 * @brief Read the count-prefixed list of strings
+	 * 
+	 * @return std::vector<std::string> - the strings that were read
+	 */
+	std::vector<std::string> ReadStrings()
+	{
+		const auto size = ReadCount();
+		std::vector<std::string> values{};
+		values.reserve(size);
+		for(auto count = size; count && !failed_; --count)
+		{
+			values.emplace_back(ReadString());
+		}
+
+		return values;
+	}
+
+	/**
+	 * @brief Get the number of the bytes left to read
+	 * 
+	 * @return std::size_t - the number of the bytes
+	 */
+	std::size_t GetSize() const
+	{
+		return data_.size();
+	}
+
+	/**
+	 * @brief Check if all the reads succeeded
+	 * 
+	 * @return true if the data was long enough for every read, false otherwise
+	 */
+	bool IsValid() const
+	{
+		return !failed_;
+	}
+
+private:
+	/**
+	 * @brief The data left to read
+	 * 
+	 */
+	std::string_view data_;
+
+	/**
+	 * @brief Whether any of the reads ran out of data
+	 * 
+	 */
+	bool failed_{false};
+};
+} // namespace utils::binary
\ No newline at end of file
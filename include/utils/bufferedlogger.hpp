@@ -61,6 +61,38 @@ public:
 	 */
 	void Flush();
 
+	/**
+	 * @brief Check if the current buffered message is going to be logged
+	 * 
+	 * @return true if the values should be appended, false if they would be dropped anyway
+	 */
+	bool IsBuffering() const noexcept
+	{
+		return IsEnabled(buffer_log_level_);
+	}
+
+	/**
+	 * @brief Log the message of the constant level, made by the stream operations of the function
+	 * 
+	 * @note The call compiles to nothing, if the level is below the compiled one, and the function
+	 *       is not called, if the level is below the minimum one
+	 * 
+	 * @param function - the function that puts the message into the logger
+	 */
+	template<LogLevel Level, typename Function>
+	void Write(Function&& function)
+	{
+		if constexpr(IsCompiled(Level))
+		{
+			if(IsEnabled(Level))
+			{
+				SetBufferLogLevel(Level);
+				function(*this);
+				Flush();
+			}
+		}
+	}
+
 protected:
 	/**
 	 * @brief Construct a new BufferedLogger object
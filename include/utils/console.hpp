@@ -0,0 +1,140 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace utils
+{
+/**
+ * @brief The class is used to print the output of the build actions to the terminal
+ * 
+ * @note The blocks of the output are queued by the workers and written by a background thread,
+ *       so the blocks are never interleaved and a slow terminal never stalls the build
+ */
+class Console
+{
+public:
+	/**
+	 * @brief Set the stream to print the output to, the standard error is used by default
+	 * 
+	 * @param stream the stream to use
+	 */
+	static void SetStream(std::FILE* stream);
+
+	/**
+	 * @brief Set the job, the output of which is printed as soon as it's read
+	 * 
+	 * @note Must be called before the build is started
+	 * 
+	 * @param job_name the name of the job to focus on, empty to print all the output by blocks
+	 */
+	static void SetFocus(std::string_view job_name);
+
+	/**
+	 * @brief Check if the output of the job is printed as soon as it's read
+	 * 
+	 * @param job_name the name of the job to check
+	 * @return true if the job is focused, false otherwise
+	 */
+	static bool IsFocused(std::string_view job_name);
+
+	/**
+	 * @brief Queue the block of the output to be printed, without waiting for the terminal
+	 * 
+	 * @param block the text to print as a whole
+	 */
+	static void Write(std::string block);
+
+	/**
+	 * @brief Wait until all the queued blocks are printed
+	 * 
+	 */
+	static void Flush();
+
+	/**
+	 * @brief Print all the queued blocks and stop the writer
+	 * 
+	 */
+	static void Close();
+
+protected:
+	/**
+	 * @brief Print the queued blocks, until the console is closed
+	 * 
+	 */
+	static void Work();
+
+protected:
+	/**
+	 * @brief The mutex which guards the queue and the state of the writer
+	 * 
+	 */
+	static std::mutex mutex_;
+
+	/**
+	 * @brief The condition the writer waits for the blocks on, and the flushes wait for the writer on
+	 * 
+	 */
+	static std::condition_variable condition_;
+
+	/**
+	 * @brief The blocks, which are not printed yet
+	 * 
+	 */
+	static std::vector<std::string> blocks_;
+
+	/**
+	 * @brief The thread that prints the blocks
+	 * 
+	 */
+	static std::thread writer_;
+
+	/**
+	 * @brief Whether the writer accepts the blocks
+	 * 
+	 */
+	static bool open_;
+
+	/**
+	 * @brief Whether the writer is printing the blocks, taken from the queue
+	 * 
+	 */
+	static bool writing_;
+
+	/**
+	 * @brief The stream to print the output to
+	 * 
+	 */
+	static std::FILE* stream_;
+
+	/**
+	 * @brief The name of the focused job
+	 * 
+	 */
+	static std::string focus_;
+};
+} // namespace utils
\ No newline at end of file
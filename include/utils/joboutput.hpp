@@ -0,0 +1,104 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "utils/bufferedlogger.hpp"
+
+namespace utils
+{
+/**
+ * @brief The class is used to collect the output of a build action, printing it as a whole
+ * 
+ * @note The output is printed when the action finishes, every line is prefixed with the job name.
+ *       The output of the focused job is printed as soon as it's captured instead.
+ */
+class JobOutput : public BufferedLogger
+{
+public:
+	/**
+	 * @brief Get the instance of the output for the specified job
+	 * 
+	 * @param job_name the name of the job to use
+	 * @return the instance, which was created for the given job
+	 */
+	static JobOutput GetInstance(std::string_view job_name);
+
+public:
+	/**
+	 * @brief Move constructor
+	 * 
+	 * @param rhs another instance to move data from
+	 */
+	JobOutput(JobOutput&& rhs);
+
+	/**
+	 * @brief Destroy the JobOutput object, printing the output that is left
+	 * 
+	 */
+	~JobOutput();
+
+public:
+	/**
+	 * @brief Capture the piece of the output of the action
+	 * 
+	 * @param data the output to capture
+	 */
+	void Capture(std::string_view data);
+
+	/**
+	 * @brief Print the captured output and put it into the log file as an entry
+	 * 
+	 */
+	void Flush();
+
+protected:
+	/**
+	 * @brief Construct a new JobOutput object
+	 * 
+	 * @param job_name the name of the job to use
+	 */
+	explicit JobOutput(std::string_view job_name);
+
+protected:
+	/**
+	 * @brief Append the output to the block, prefixing every line with the job name
+	 * 
+	 * @param block the block to append the output to
+	 * @param data the output to append
+	 */
+	void Prefix(std::string& block, std::string_view data);
+
+protected:
+	/**
+	 * @brief Whether the output is printed as soon as it's captured
+	 * 
+	 */
+	bool focused_;
+
+	/**
+	 * @brief Whether the next captured character starts a new line
+	 * 
+	 */
+	bool line_start_{true};
+};
+} // namespace utils
\ No newline at end of file
@@ -0,0 +1,159 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utils/logformat.hpp"
+#include "utils/logger.hpp"
+
+namespace utils
+{
+/**
+ * @brief The decoder of the binary log files, turning them back into text or JSON lines
+ * 
+ * @note A binary log file starts with the magic and the version, followed by the records. Every
+ *       record starts with it's tag. The formats and the components are defined by their own
+ *       records before the first entry that refers to them.
+ */
+class LogDecoder
+{
+public:
+	/**
+	 * @brief The tag of a record
+	 * 
+	 */
+	enum class Tag : std::uint8_t
+	{
+		kFormat,
+		kComponent,
+		kEntry
+	};
+
+	/**
+	 * @brief The format of the decoded entries
+	 * 
+	 */
+	enum class Output
+	{
+		kText,
+		kJson
+	};
+
+public:
+	/**
+	 * @brief Construct a new LogDecoder object
+	 * 
+	 * @param output - the format of the decoded entries
+	 */
+	explicit LogDecoder(Output output);
+
+public:
+	/**
+	 * @brief Decode the binary log, writing a line per entry
+	 * 
+	 * @throw exceptions::InvalidLogException if the data is malformed
+	 * 
+	 * @param data - the contents of the binary log file
+	 * @param stream - the stream to write the lines to
+	 */
+	void Decode(std::string_view data, std::ostream& stream);
+
+protected:
+	/**
+	 * @brief Append the entry as a line of text
+	 * 
+	 * @param line - the line to append to
+	 * @param time - the time of the entry, in nanoseconds since the epoch
+	 * @param component_name - the name of the component that logged the entry
+	 * @param message - the rendered message of the entry
+	 */
+	static void AppendText(std::string& line, std::int64_t time, std::string_view component_name,
+						   std::string_view message);
+
+	/**
+	 * @brief Append the entry as a JSON object
+	 * 
+	 * @param line - the line to append to
+	 * @param time - the time of the entry, in nanoseconds since the epoch
+	 * @param level - the log level of the entry
+	 * @param component_name - the name of the component that logged the entry
+	 * @param format - the format string of the entry
+	 * @param message - the rendered message of the entry
+	 * @param values - the arguments of the entry
+	 */
+	static void AppendJson(std::string& line, std::int64_t time, Logger::LogLevel level,
+						   std::string_view component_name, std::string_view format, std::string_view message,
+						   const std::vector<LogFormat::Value>& values);
+
+	/**
+	 * @brief Append the floating-point number as a JSON number, or null if it's not finite
+	 * 
+	 * @param line - the line to append to
+	 * @param value - the number to append
+	 */
+	static void AppendNumber(std::string& line, double value);
+
+	/**
+	 * @brief Append the string as a JSON string literal
+	 * 
+	 * @param line - the line to append to
+	 * @param value - the string to append
+	 */
+	static void AppendString(std::string& line, std::string_view value);
+
+public:
+	/**
+	 * @brief The signature of the binary logs, "BBSL" in the little-endian byte order
+	 * 
+	 */
+	static constexpr std::uint32_t kMagic = 0x4c534242;
+
+	/**
+	 * @brief The version of the binary logs' layout
+	 * 
+	 */
+	static constexpr std::uint32_t kVersion = 1;
+
+protected:
+	/**
+	 * @brief The format of the decoded entries
+	 * 
+	 */
+	const Output output_;
+
+	/**
+	 * @brief The format strings, defined by the log
+	 * 
+	 */
+	std::map<std::uint32_t, std::string> formats_;
+
+	/**
+	 * @brief The component names, defined by the log
+	 * 
+	 */
+	std::map<std::uint32_t, std::string> components_;
+};
+} // namespace utils
\ No newline at end of file
@@ -0,0 +1,231 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace utils
+{
+/**
+ * @brief A format string of the log entries, registered once and identified by it's ID
+ * 
+ * @note Every "{}" in the format string is replaced by the next argument. The entries only keep
+ *       the ID of the format and the typed arguments, the text is made by the writer or the decoder.
+ */
+class LogFormat
+{
+public:
+	/**
+	 * @brief The identifier of a format string
+	 * 
+	 */
+	using Id = std::uint32_t;
+
+	/**
+	 * @brief The type of an encoded argument
+	 * 
+	 */
+	enum class Type : std::uint8_t
+	{
+		kSigned,
+		kUnsigned,
+		kDouble,
+		kString
+	};
+
+	/**
+	 * @brief The decoded value of an argument
+	 * 
+	 */
+	using Value = std::variant<std::int64_t, std::uint64_t, double, std::string_view>;
+
+	/**
+	 * @brief An argument of an entry, encoded without any allocations
+	 * 
+	 */
+	class Argument
+	{
+	public:
+		/**
+		 * @brief Construct a new Argument object from a number
+		 * 
+		 * @param value - the value of the argument
+		 */
+		template<typename T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
+		Argument(T value)
+		{
+			if constexpr(std::is_floating_point_v<T>)
+			{
+				Set(Type::kDouble, static_cast<double>(value));
+			}
+			else if constexpr(std::is_signed_v<T>)
+			{
+				Set(Type::kSigned, static_cast<std::int64_t>(value));
+			}
+			else
+			{
+				Set(Type::kUnsigned, static_cast<std::uint64_t>(value));
+			}
+		}
+
+		/**
+		 * @brief Construct a new Argument object from a string, which must outlive the argument
+		 * 
+		 * @param value - the value of the argument
+		 */
+		Argument(std::string_view value)
+			: tail_{value}
+		{
+			Set(Type::kString, static_cast<std::uint32_t>(value.size()));
+		}
+
+	public:
+		/**
+		 * @brief Get the type and the fixed-size part of the value
+		 * 
+		 * @return std::string_view - the encoded bytes
+		 */
+		std::string_view GetHead() const noexcept
+		{
+			return {head_, size_};
+		}
+
+		/**
+		 * @brief Get the variable-size part of the value
+		 * 
+		 * @return std::string_view - the characters of a string, empty for numbers
+		 */
+		std::string_view GetTail() const noexcept
+		{
+			return tail_;
+		}
+
+	protected:
+		/**
+		 * @brief Encode the type and the fixed-size part of the value
+		 * 
+		 * @param type - the type of the argument
+		 * @param value - the value to encode
+		 */
+		template<typename T>
+		void Set(Type type, T value) noexcept
+		{
+			head_[0] = static_cast<char>(type);
+			std::memcpy(head_ + 1, &value, sizeof(value));
+			size_ = static_cast<std::uint8_t>(1 + sizeof(value));
+		}
+
+	protected:
+		/**
+		 * @brief The type and the fixed-size part of the value
+		 * 
+		 */
+		char head_[1 + sizeof(std::uint64_t)]{};
+
+		/**
+		 * @brief The number of the used bytes of the head
+		 * 
+		 */
+		std::uint8_t size_{0};
+
+		/**
+		 * @brief The characters of a string argument
+		 * 
+		 */
+		std::string_view tail_{};
+	};
+
+public:
+	/**
+	 * @brief Construct a new LogFormat object, registering the format string
+	 * 
+	 * @param format - the format string
+	 */
+	explicit LogFormat(std::string_view format);
+
+public:
+	/**
+	 * @brief Get the ID of the format string
+	 * 
+	 * @return Id - the ID, unique within the process
+	 */
+	Id GetId() const noexcept;
+
+	/**
+	 * @brief Get the registered format string
+	 * 
+	 * @param id - the ID of the format string
+	 * @return std::string_view - the format string, empty if the ID is unknown
+	 */
+	static std::string_view GetFormat(Id id);
+
+	/**
+	 * @brief Decode the arguments of an entry
+	 * 
+	 * @param arguments - the encoded arguments
+	 * @param values - the vector to put the values into
+	 * @return true if all the arguments were decoded, false if the data is malformed
+	 */
+	static bool Decode(std::string_view arguments, std::vector<Value>& values);
+
+	/**
+	 * @brief Substitute the values into the format string
+	 * 
+	 * @param output - the string to append the result to
+	 * @param format - the format string
+	 * @param values - the values of the arguments
+	 */
+	static void Render(std::string& output, std::string_view format, const std::vector<Value>& values);
+
+	/**
+	 * @brief Append the textual representation of the value
+	 * 
+	 * @param output - the string to append the value to
+	 * @param value - the value to append
+	 */
+	static void Append(std::string& output, const Value& value);
+
+public:
+	/**
+	 * @brief The ID of the format, used for the plain messages
+	 * 
+	 */
+	static constexpr Id kMessage = 0;
+
+	/**
+	 * @brief The format of the timestamps of the textual entries
+	 * 
+	 */
+	static constexpr char kTimeFormat[] = "%d.%m.%Y %H:%M:%S";
+
+protected:
+	/**
+	 * @brief The ID of the format string
+	 * 
+	 */
+	Id id_;
+};
+} // namespace utils
\ No newline at end of file
@@ -19,16 +19,41 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
 #include <fstream>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
+
+#include "utils/logformat.hpp"
+#include "utils/ringbuffer.hpp"
+
+// clang-format off
+// The lowest log level, compiled into the binary, the entries below it are removed by the compiler
+#ifndef BBS_LOG_LEVEL
+    #ifdef NDEBUG
+        #define BBS_LOG_LEVEL 1
+    #else
+        #define BBS_LOG_LEVEL 0
+    #endif
+#endif
+// clang-format on
 
 namespace utils
 {
 /**
  * @brief The class is used to store user-defined entries into the log file
  * 
+ * @note The entries are put into the buffers of the threads that log them, without any locks.
+ *       A background writer formats the entries and writes them to the file in batches.
  */
 class Logger
 {
@@ -46,6 +71,16 @@ public:
 		kInfo
 	};
 
+	/**
+	 * @brief The format of the log file
+	 * 
+	 */
+	enum class Sink
+	{
+		kText,
+		kBinary
+	};
+
 public:
 	/**
 	 * @brief Deleted copy constructor
@@ -79,8 +114,9 @@ public:
 	 * @brief Set the log file
 	 * 
 	 * @param file the name of the file to use
+	 * @param sink the format to write the entries in
 	 */
-	static void SetFile(std::string_view file);
+	static void SetFile(std::string_view file, Sink sink = Sink::kText);
 
 	/**
 	 * @brief Set the minimum level for the logs
@@ -89,6 +125,28 @@ public:
 	 */
 	static void SetMinimumLogLevel(LogLevel level) noexcept;
 
+	/**
+	 * @brief Check if the entries of the level are compiled in
+	 * 
+	 * @param level the log level to check
+	 * @return true if the entries of the level might be logged, false if they are always dropped
+	 */
+	static constexpr bool IsCompiled(LogLevel level) noexcept
+	{
+		return level >= kCompiledLogLevel;
+	}
+
+	/**
+	 * @brief Check if the entries of the level are logged, before anything is formatted
+	 * 
+	 * @param level the log level to check
+	 * @return true if the entries of the level are logged, false otherwise
+	 */
+	static bool IsEnabled(LogLevel level) noexcept
+	{
+		return IsCompiled(level) && level >= minimum_log_level_;
+	}
+
 	/**
 	 * @brief Get the instance of the logger for the specified component
 	 * 
@@ -98,11 +156,17 @@ public:
 	static Logger GetInstance(std::string_view component_name);
 
 	/**
-	 * @brief Close the stream, used for the logging
+	 * @brief Close the stream, used for the logging, writing all the pending entries
 	 * 
 	 */
 	static void Close();
 
+	/**
+	 * @brief Write all the pending entries to the file
+	 * 
+	 */
+	static void Flush();
+
 public:
 	/**
 	 * @brief Put the message into the log file
@@ -112,6 +176,45 @@ public:
 	 */
 	void Log(LogLevel level, std::string_view message) const;
 
+	/**
+	 * @brief Put the entry with the typed arguments into the log file
+	 * 
+	 * @param level the log level of the entry
+	 * @param format the format of the entry
+	 * @param arguments the numbers and the strings to substitute into the format
+	 */
+	template<typename... Args>
+	void Log(LogLevel level, const LogFormat& format, const Args&... arguments) const
+	{
+		static_assert(sizeof...(Args) <= kMaximumArguments, "Too many arguments for a log entry");
+
+		// Nothing is encoded, if the entry is not going to be written
+		if(!IsEnabled(level) || !open_.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		const std::array<LogFormat::Argument, sizeof...(Args)> values{LogFormat::Argument{arguments}...};
+		Write(level, format.GetId(), values.data(), values.size());
+	}
+
+	/**
+	 * @brief Put the entry of the constant level into the log file
+	 * 
+	 * @note The call compiles to nothing, if the level is below the compiled one
+	 * 
+	 * @param format the format of the entry
+	 * @param arguments the numbers and the strings to substitute into the format
+	 */
+	template<LogLevel Level, typename... Args>
+	void Log(const LogFormat& format, const Args&... arguments) const
+	{
+		if constexpr(IsCompiled(Level))
+		{
+			Log(Level, format, arguments...);
+		}
+	}
+
 protected:
 	/**
 	 * @brief Construct a new Logger object
@@ -120,6 +223,63 @@ protected:
 	 */
 	explicit Logger(std::string_view component_name);
 
+protected:
+	/**
+	 * @brief Put the encoded entry into the buffer of the calling thread
+	 * 
+	 * @param level the log level of the entry
+	 * @param format the ID of the format of the entry
+	 * @param arguments the arguments of the entry
+	 * @param count the number of the arguments
+	 */
+	void Write(LogLevel level, LogFormat::Id format, const LogFormat::Argument* arguments,
+			   std::size_t count) const;
+
+	/**
+	 * @brief Get the buffer of the calling thread, registering it on the first call
+	 * 
+	 * @return RingBuffer& - the buffer of the thread
+	 */
+	static RingBuffer& GetBuffer();
+
+	/**
+	 * @brief Format the entries of all the buffers and write them to the stream
+	 * 
+	 * @note Must be called with the mutex locked
+	 */
+	static void Drain();
+
+	/**
+	 * @brief Format the entry as a line of text, appending it to the batch
+	 * 
+	 * @param batch - the text to append the entry to
+	 * @param time - the time the entry was logged at, in nanoseconds since the epoch
+	 * @param component_name - the name of the component that logged the entry
+	 * @param format - the ID of the format of the entry
+	 * @param arguments - the encoded arguments of the entry
+	 */
+	static void Format(std::string& batch, std::int64_t time, std::string_view component_name,
+					   LogFormat::Id format, std::string_view arguments);
+
+	/**
+	 * @brief Encode the entry as a binary record, appending it to the batch
+	 * 
+	 * @param batch - the data to append the record to
+	 * @param time - the time the entry was logged at, in nanoseconds since the epoch
+	 * @param level - the log level of the entry
+	 * @param component_name - the name of the component that logged the entry
+	 * @param format - the ID of the format of the entry
+	 * @param arguments - the encoded arguments of the entry
+	 */
+	static void Encode(std::string& batch, std::int64_t time, LogLevel level, std::string_view component_name,
+					   LogFormat::Id format, std::string_view arguments);
+
+	/**
+	 * @brief Drain the buffers periodically, until the stream is closed
+	 * 
+	 */
+	static void Work();
+
 protected:
 	/**
 	 * @brief The file stream to log the messages into
@@ -128,11 +288,77 @@ protected:
 	static std::ofstream stream_;
 
 	/**
-	 * @brief The mutex which allows to do one thing at a time in this component
+	 * @brief The mutex which guards the stream and the list of the buffers
 	 * 
 	 */
 	static std::mutex mutex_;
 
+	/**
+	 * @brief Whether the entries are accepted, checked without the lock
+	 * 
+	 */
+	static std::atomic<bool> open_;
+
+	/**
+	 * @brief The buffers of all the threads that have logged anything
+	 * 
+	 */
+	static std::vector<std::shared_ptr<RingBuffer>> buffers_;
+
+	/**
+	 * @brief The thread that writes the entries to the stream
+	 * 
+	 */
+	static std::thread writer_;
+
+	/**
+	 * @brief The condition the writer waits on in between the writes
+	 * 
+	 */
+	static std::condition_variable condition_;
+
+	/**
+	 * @brief The second the cached timestamp was formatted for
+	 * 
+	 */
+	static std::time_t time_;
+
+	/**
+	 * @brief The cached timestamp, formatted once per second
+	 * 
+	 */
+	static std::string timestamp_;
+
+	/**
+	 * @brief The format of the current log file
+	 * 
+	 */
+	static Sink sink_;
+
+	/**
+	 * @brief The format strings, already written to the binary log file
+	 * 
+	 */
+	static std::vector<bool> formats_;
+
+	/**
+	 * @brief The IDs of the component names, already written to the binary log file
+	 * 
+	 */
+	static std::map<std::string, std::uint32_t, std::less<>> components_;
+
+	/**
+	 * @brief The maximum number of the arguments of an entry
+	 * 
+	 */
+	static constexpr std::size_t kMaximumArguments = 16;
+
+	/**
+	 * @brief The lowest log level, compiled into the binary
+	 * 
+	 */
+	static constexpr LogLevel kCompiledLogLevel = static_cast<LogLevel>(BBS_LOG_LEVEL);
+
 	/**
 	 * @brief Minimum accepted log level
 	 * 
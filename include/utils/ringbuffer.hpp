@@ -0,0 +1,218 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+
+namespace utils
+{
+/**
+ * @brief A lock-free buffer of variable-sized records for a single producer and a single consumer
+ * 
+ * @note A record never wraps around the end of the buffer, so the consumer always gets it as
+ *       a contiguous view. The space at the end, which is too small for a record, is skipped.
+ */
+class RingBuffer
+{
+public:
+	/**
+	 * @brief Construct a new RingBuffer object
+	 * 
+	 * @param capacity - the size of the buffer in bytes, must be a power of two
+	 */
+	explicit RingBuffer(std::size_t capacity)
+		: data_{std::make_unique<char[]>(capacity)}
+		, capacity_{capacity}
+	{}
+
+public:
+	/**
+	 * @brief Write the record, made of the parts, called by the producer only
+	 * 
+	 * @param parts - the parts of the record
+	 * @return true if the record was written, false if there is not enough space for it
+	 */
+	bool Write(std::initializer_list<std::string_view> parts)
+	{
+		return Write(parts.begin(), parts.size());
+	}
+
+	/**
+	 * @brief Write the record, made of the parts, called by the producer only
+	 * 
+	 * @param parts - the first of the parts of the record
+	 * @param count - the number of the parts
+	 * @return true if the record was written, false if there is not enough space for it
+	 */
+	bool Write(const std::string_view* parts, std::size_t count)
+	{
+		std::size_t size{0};
+		for(std::size_t index = 0; index < count; ++index)
+		{
+			size += parts[index].size();
+		}
+
+		const auto head   = head_.load(std::memory_order_relaxed);
+		const auto offset = head & (capacity_ - 1);
+		const auto length = Align(sizeof(std::uint32_t) + size);
+
+		// The record is moved to the start, if it doesn't fit in between the offset and the end
+		const auto padding = capacity_ - offset < length ? capacity_ - offset : 0;
+		if(capacity_ - (head - tail_.load(std::memory_order_acquire)) < padding + length)
+		{
+			return false;
+		}
+
+		if(padding)
+		{
+			WriteSize(offset, kPadding);
+		}
+
+		auto position = (head + padding) & (capacity_ - 1);
+		WriteSize(position, static_cast<std::uint32_t>(size));
+		position += sizeof(std::uint32_t);
+		for(std::size_t index = 0; index < count; ++index)
+		{
+			std::memcpy(data_.get() + position, parts[index].data(), parts[index].size());
+			position += parts[index].size();
+		}
+
+		head_.store(head + padding + length, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * @brief Read all the written records, called by the consumer only
+	 * 
+	 * @param consumer - the function to call for every record, the view is valid during the call only
+	 * @return std::size_t - the number of the records that were read
+	 */
+	template<typename Consumer>
+	std::size_t Read(Consumer&& consumer)
+	{
+		std::size_t count{0};
+		auto tail       = tail_.load(std::memory_order_relaxed);
+		const auto head = head_.load(std::memory_order_acquire);
+		while(tail != head)
+		{
+			const auto offset = tail & (capacity_ - 1);
+			const auto size   = ReadSize(offset);
+			if(size == kPadding)
+			{
+				tail += capacity_ - offset;
+				continue;
+			}
+
+			consumer(std::string_view{data_.get() + offset + sizeof(std::uint32_t), size});
+			tail += Align(sizeof(std::uint32_t) + size);
+			++count;
+
+			// Release the space as soon as possible, so the producer doesn't have to wait
+			tail_.store(tail, std::memory_order_release);
+		}
+
+		tail_.store(tail, std::memory_order_release);
+		return count;
+	}
+
+	/**
+	 * @brief Check if all the written records were read
+	 * 
+	 * @return true if there are no records to read, false otherwise
+	 */
+	bool IsEmpty() const
+	{
+		return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+	}
+
+protected:
+	/**
+	 * @brief Round the size up, so the sizes of the records are always aligned
+	 * 
+	 * @param size - the size to align
+	 * @return std::size_t - the aligned size
+	 */
+	static constexpr std::size_t Align(std::size_t size)
+	{
+		return (size + sizeof(std::uint32_t) - 1) & ~(sizeof(std::uint32_t) - 1);
+	}
+
+	/**
+	 * @brief Write the size of a record at the offset
+	 * 
+	 * @param offset - the offset in the buffer
+	 * @param size - the size to write
+	 */
+	void WriteSize(std::size_t offset, std::uint32_t size)
+	{
+		std::memcpy(data_.get() + offset, &size, sizeof(size));
+	}
+
+	/**
+	 * @brief Read the size of a record at the offset
+	 * 
+	 * @param offset - the offset in the buffer
+	 * @return std::uint32_t - the size of the record
+	 */
+	std::uint32_t ReadSize(std::size_t offset) const
+	{
+		std::uint32_t size{};
+		std::memcpy(&size, data_.get() + offset, sizeof(size));
+		return size;
+	}
+
+protected:
+	/**
+	 * @brief The size that marks the skipped space at the end of the buffer
+	 * 
+	 */
+	static constexpr std::uint32_t kPadding = 0xffffffff;
+
+	/**
+	 * @brief The data of the records
+	 * 
+	 */
+	std::unique_ptr<char[]> data_;
+
+	/**
+	 * @brief The size of the buffer
+	 * 
+	 */
+	const std::size_t capacity_;
+
+	/**
+	 * @brief The total number of the bytes written, updated by the producer
+	 * 
+	 */
+	alignas(64) std::atomic<std::size_t> head_{0};
+
+	/**
+	 * @brief The total number of the bytes read, updated by the consumer
+	 * 
+	 */
+	alignas(64) std::atomic<std::size_t> tail_{0};
+};
+} // namespace utils
\ No newline at end of file
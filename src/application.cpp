@@ -19,39 +19,158 @@
 
 #include "application.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <system_error>
 
 #include "parser/parser.hpp"
 #include "scheduler/pipeline/job.hpp"
 
 const static std::string kBuildFile = "build.bbs";
+const static std::string kCacheDirectory = ".bbs-cache";
+const static std::string kListingsFile = "listings.bin";
+
+Application::Application(std::size_t jobs, bool unity)
+	: jobs_{jobs}
+	, unity_{unity}
+	, executor_{jobs}
+	, cache_{kCacheDirectory}
+	, walker_{std::filesystem::path{kCacheDirectory} / kListingsFile, jobs}
+{}
 
 void Application::Process(std::filesystem::path path)
 {
-	parser::Parser parser{path / kBuildFile};
+	projects_.clear();
+
+	// Parse the whole tree first, dependencies are parsed as soon as they are known
+	{
+		scheduler::ThreadPool pool{jobs_};
+		pool.Submit([this, &pool, path] { Discover(pool, path); });
+		pool.Wait();
+	}
+
+	std::set<std::filesystem::path> visited{};
+	Schedule(Normalize(path), visited);
+	walker_.Save();
+}
+
+void Application::Build()
+{
+	executor_.Run();
+}
+
+void Application::Discover(scheduler::ThreadPool& pool, std::filesystem::path path)
+{
+	// Every project is parsed once, no matter how many projects depend on it
+	const auto key = Normalize(path);
+	{
+		std::unique_lock<std::mutex> lock{mutex_};
+		if(!projects_.try_emplace(key).second)
+		{
+			return;
+		}
+	}
+
+	const auto file = path / kBuildFile;
 	try
 	{
-		auto job = parser.Process();
-		job.SetProjectPath(path);
+		// Parse the build file only if it has changed since the last run
+		auto job = cache_.Load(file);
+		if(!job)
+		{
+			parser::Parser parser{file};
+			job.emplace(parser.Process());
+			cache_.Store(file, *job);
+		}
+
+		job->SetProjectPath(path);
+		ExpandFiles(*job);
 
 		// Process dependencies
-		for(const auto& dependency : job.GetDependencies())
+		for(const auto& dependency : job->GetDependencies())
 		{
-			Process(path / dependency);
+			pool.Submit([this, &pool, dependency = path / dependency] { Discover(pool, dependency); });
 		}
 
+		std::unique_lock<std::mutex> lock{mutex_};
+		projects_[key].emplace(std::move(*job));
+	}
+	catch(const std::exception& ex)
+	{
+		std::unique_lock<std::mutex> lock{mutex_};
+		std::cout << ex.what() << std::endl;
+	}
+}
+
+void Application::Schedule(const std::filesystem::path& path, std::set<std::filesystem::path>& visited)
+{
+	// Shared dependencies are built once, a cycle is cut at the project seen again
+	if(!visited.insert(path).second)
+	{
+		return;
+	}
+
+	auto& job = projects_[path];
+	if(!job)
+	{
+		return;
+	}
+
+	for(const auto& dependency : job->GetDependencies())
+	{
+		Schedule(Normalize(job->GetProjectPath() / dependency), visited);
+	}
+
+	try
+	{
 		// Create a new pipeline to build the project
-		scheduler::pipeline::Pipeline pipeline{std::move(job)};
+		scheduler::pipeline::Pipeline pipeline{std::move(*job), unity_};
 		executor_.Add(std::move(pipeline));
 	}
 	catch(const std::exception& ex)
 	{
 		std::cout << ex.what() << std::endl;
-		return;
 	}
+
+	job.reset();
 }
 
-void Application::Build()
+void Application::ExpandFiles(scheduler::pipeline::Job& job)
 {
-	executor_.Run();
+	const auto& files = job.GetFiles();
+	const auto pattern = [](const auto& file) { return sys::Walker::IsPattern(file.native()); };
+	if(std::none_of(files.begin(), files.end(), pattern))
+	{
+		return;
+	}
+
+	// The patterns are expanded on every run, the matching files might change without the build file
+	std::vector<std::filesystem::path> result{};
+	for(const auto& file : files)
+	{
+		if(!pattern(file))
+		{
+			result.push_back(file);
+			continue;
+		}
+
+		for(auto& match : walker_.Glob(job.GetProjectPath(), file.generic_string()))
+		{
+			result.push_back(std::move(match));
+		}
+	}
+
+	job.SetFiles(std::move(result));
 }
+
+std::filesystem::path Application::Normalize(const std::filesystem::path& path)
+{
+	std::error_code error{};
+	auto result = std::filesystem::weakly_canonical(path, error);
+	if(error)
+	{
+		return path.lexically_normal();
+	}
+
+	return result;
+}
\ No newline at end of file
@@ -19,34 +19,28 @@
 
 #include "lexer/handlers/wordhandler.hpp"
 
+#include <algorithm>
+#include <cctype>
+
 #include "parser/tokens/word.hpp"
 
 namespace lexer::handlers
 {
 std::unique_ptr<WordHandler::Token> WordHandler::Process(Scanner& scanner) const
 {
-	std::string value{};
-	std::optional<char> option;
-	while(option = scanner.Get())
-	{
-		// Break the loop if the character is not a part of an identifier
-		const auto character = option.value();
-		if(!std::isalpha(character))
-		{
-			break;
-		}
-
-		// Append the character to the resulting string
-		value += character;
-
-		// Actually make a move
-		scanner.Move();
-	}
+	// Find the end of the identifier in the current line
+	const auto line = scanner.Peek();
+	const auto end = std::find_if_not(line.begin(), line.end(), [](unsigned char character) {
+		return std::isalpha(character);
+	});
 
 	// Return the token, if it's value is not empty
-	if(!value.empty())
+	const auto length = static_cast<std::size_t>(std::distance(line.begin(), end));
+	if(length != 0)
 	{
-		return std::make_unique<parser::tokens::Word>(value);
+		auto token = std::make_unique<parser::tokens::Word>(std::string{line.substr(0, length)});
+		scanner.Move(length);
+		return token;
 	}
 
 	return Handler::Process(scanner);
@@ -19,40 +19,90 @@
 
 #include "lexer/lexer.hpp"
 
-#include "lexer/handlers/operatorhandler.hpp"
-#include "lexer/handlers/punctuatorhandler.hpp"
-#include "lexer/handlers/separatorhandler.hpp"
-#include "lexer/handlers/wordhandler.hpp"
+#include "lexer/charactertable.hpp"
+#include "lexer/exceptions/unexpectedlexemeexception.hpp"
 
 namespace lexer
 {
 Lexer::Lexer(const std::filesystem::path& path)
 	: scanner_{path}
-{
-	auto separator_handler = std::make_unique<handlers::SeparatorHandler>();
-	separator_handler->SetNext(std::make_unique<handlers::OperatorHandler>());
+{}
 
-	auto word_handler = std::make_unique<handlers::WordHandler>();
-	word_handler->SetNext(std::move(separator_handler));
+const Context& Lexer::GetContext() const
+{
+	return scanner_.GetContext();
+}
 
-	// Set the main handler
-	handler_ = std::make_unique<handlers::PunctuatorHandler>();
-	handler_->SetNext(std::move(word_handler));
+void Lexer::SetHandler(std::unique_ptr<handlers::Handler> handler)
+{
+	handler_ = std::move(handler);
 }
 
-const Context& Lexer::GetContext() const
+const Lexer::Lexeme* Lexer::Next()
 {
-	return scanner_.GetContext();
+	// Let the custom chain of handlers do the job, if there is one
+	if(handler_)
+	{
+		const auto offset = scanner_.GetOffset();
+		extension_ = handler_->Process(scanner_);
+		token_.reset();
+		if(extension_)
+		{
+			token_ = extension_->ToLexeme();
+			token_->offset = offset;
+		}
+
+		return Get();
+	}
+
+	token_ = Scan();
+	return Get();
 }
 
-std::shared_ptr<Lexer::Token> Lexer::Next()
+const Lexer::Lexeme* Lexer::Get() const
 {
-	token_ = std::move(handler_->Process(scanner_));
-	return token_;
+	return token_ ? &token_.value() : nullptr;
 }
 
-std::shared_ptr<Lexer::Token> Lexer::Get() const
+std::optional<Lexer::Lexeme> Lexer::Scan()
 {
-	return token_;
+	using namespace parser::tokens;
+
+	// If the line is empty, then the end of the file reached
+	const auto line = scanner_.Peek();
+	if(line.empty())
+	{
+		return {};
+	}
+
+	const auto offset = scanner_.GetOffset();
+	const auto entry = kCharacterTable[static_cast<unsigned char>(line.front())];
+	switch(entry.type)
+	{
+	case CharacterClass::kLetter:
+	{
+		// Take the whole identifier at once
+		std::size_t length = 1;
+		while(length < line.size() &&
+			  kCharacterTable[static_cast<unsigned char>(line[length])].type == CharacterClass::kLetter)
+		{
+			++length;
+		}
+
+		scanner_.Move(length);
+		return Lexeme{Lexeme::Kind::kWord, 0, line.substr(0, length), offset};
+	}
+	case CharacterClass::kPunctuator:
+		scanner_.Move(1);
+		return Lexeme{Lexeme::Kind::kPunctuator, entry.subtype, line.substr(0, 1), offset};
+	case CharacterClass::kSeparator:
+		scanner_.Move(1);
+		return Lexeme{Lexeme::Kind::kSeparator, entry.subtype, line.substr(0, 1), offset};
+	case CharacterClass::kOperator:
+		scanner_.Move(1);
+		return Lexeme{Lexeme::Kind::kOperator, entry.subtype, line.substr(0, 1), offset};
+	default:
+		throw exceptions::UnexpectedLexemeException(scanner_.GetContext());
+	}
 }
 } // namespace lexer
\ No newline at end of file
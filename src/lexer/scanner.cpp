@@ -21,7 +21,6 @@
 
 #include <cctype>
 
-#include "exceptions/filenotfoundexception.hpp"
 #include "lexer/exceptions/fileemptyexception.hpp"
 
 namespace lexer
@@ -30,58 +29,38 @@ namespace constants
 {
 constexpr char kComment = '#';
 constexpr char kEndOfFile = '\0';
+constexpr char kNewLine = '\n';
 } // namespace constants
 
 Scanner::Scanner(const std::filesystem::path& path)
+	: file_{path}
+	, data_{file_.GetData()}
 {
-	namespace fs = std::filesystem;
-
-	// If the file doesn't exist or it is not a regular file, throw an exception
-	if(!fs::exists(path) || !fs::is_regular_file(path))
-	{
-		throw ::exceptions::FileNotFoundException(path);
-	}
-
 	// Throw an exception if the file is empty
-	if(fs::is_empty(path))
+	if(data_.empty())
 	{
 		throw exceptions::FileEmptyException(path);
 	}
 
-	file_.open(path);
-	if(!file_.is_open())
-	{
-		throw ::exceptions::FileNotFoundException(path);
-	}
-
 	// Get the first line from file and initialize the iterator
-	std::string line;
-	std::getline(file_, line);
-	if(file_.fail())
+	if(!Read())
 	{
-		file_.close();
 		return;
 	}
 
-	context_.Update(std::move(line));
-
 	// Skip empty lines, spaces and comments
 	Skip();
 }
 
 Scanner::~Scanner()
 {
-	// Close the file
-	if(file_.is_open())
-	{
-		file_.close();
-	}
+	// noop, the mapping is released by the file
 }
 
 std::optional<char> Scanner::Get()
 {
-	// Don't return anything if the file is closed
-	if(!file_.is_open())
+	// Don't return anything if the end of the file is reached
+	if(finished_)
 	{
 		return {};
 	}
@@ -91,8 +70,8 @@ std::optional<char> Scanner::Get()
 
 void Scanner::Move()
 {
-	// Don't return anything if the file is closed
-	if(!file_.is_open())
+	// Don't return anything if the end of the file is reached
+	if(finished_)
 	{
 		return;
 	}
@@ -103,6 +82,44 @@ void Scanner::Move()
 	Skip();
 }
 
+void Scanner::Move(std::size_t count)
+{
+	// Don't return anything if the end of the file is reached
+	if(finished_ || count == 0)
+	{
+		return;
+	}
+
+	for(std::size_t index = 0; index < count; ++index)
+	{
+		context_.Next();
+	}
+
+	// Skip empty lines, spaces and comments
+	Skip();
+}
+
+std::string_view Scanner::Peek() const
+{
+	if(finished_)
+	{
+		return {};
+	}
+
+	return context_.GetLine().substr(context_.GetPosition());
+}
+
+std::size_t Scanner::GetOffset() const
+{
+	if(finished_)
+	{
+		return file_.GetData().size();
+	}
+
+	return static_cast<std::size_t>(context_.GetLine().data() - file_.GetData().data()) +
+		   context_.GetPosition();
+}
+
 const lexer::Context& Scanner::GetContext() const
 {
 	return context_;
@@ -114,22 +131,34 @@ void Scanner::Skip()
 	auto character = context_.GetCharacter();
 	while(!character || character.value() == constants::kComment)
 	{
-		std::string line;
-		std::getline(file_, line);
-		if(file_.fail())
+		if(!Read())
 		{
-			file_.close();
 			return;
 		}
 
-		context_.Update(std::move(line));
 		character = context_.GetCharacter();
 	}
 
 	// Check if the line still has anything to read
-	if(!character || character.value() == '\0')
+	if(!character || character.value() == constants::kEndOfFile)
+	{
+		finished_ = true;
+	}
+}
+
+bool Scanner::Read()
+{
+	// Mark the end of the file, if there are no more lines
+	if(data_.empty())
 	{
-		file_.close();
+		finished_ = true;
+		return false;
 	}
+
+	// The last line might be not terminated
+	const auto end = data_.find(constants::kNewLine);
+	context_.Update(data_.substr(0, end));
+	data_.remove_prefix(end == std::string_view::npos ? data_.size() : end + 1);
+	return true;
 }
 } // namespace lexer
\ No newline at end of file
@@ -17,33 +17,151 @@
  * under the License.
  */
 
+#include <algorithm>
+#include <cstdlib>
 #include <filesystem>
 #include <iostream>
+#include <string_view>
+#include <thread>
 
 #include "application.hpp"
+#include "sys/mappedfile.hpp"
+#include "utils/console.hpp"
+#include "utils/logdecoder.hpp"
+#include "utils/logger.hpp"
 
-static const std::string help{"Usage: bbs [PATH]\n"
-							  "Builds the project, specified by the PATH\n"};
+static const std::string help{"Usage: bbs [-j JOBS] [--unity] [--focus PROJECT] [--log FILE | --binary-log FILE] PATH\n"
+							  "       bbs log decode [--json] FILE\n"
+							  "Builds the project, specified by the PATH\n\n"
+							  "  -j JOBS              the number of files to compile simultaneously\n"
+							  "  --unity              compile the files of every project in batches, for full builds\n"
+							  "  --focus PROJECT      print the output of the PROJECT as soon as it's read\n"
+							  "  --log FILE           write the log to the FILE as text\n"
+							  "  --binary-log FILE    write the log to the FILE as binary records\n"
+							  "  log decode FILE      print the binary log as text\n"
+							  "  --json               print the binary log as JSON lines\n"};
 
-int main(int argc, char** argv)
+/**
+ * @brief Print the entries of the binary log
+ * 
+ * @param argc - the number of the arguments after "log decode"
+ * @param argv - the arguments after "log decode"
+ * @return int - the exit code
+ */
+static int Decode(int argc, char** argv)
 {
-	if(argc != 2)
+	auto output = utils::LogDecoder::Output::kText;
+	std::filesystem::path path{};
+	for(int i = 0; i < argc; ++i)
+	{
+		const std::string_view argument{argv[i]};
+		if(argument == "--json")
+		{
+			output = utils::LogDecoder::Output::kJson;
+			continue;
+		}
+
+		// Only one file is expected
+		if(!path.empty())
+		{
+			std::cout << help << std::endl;
+			return 1;
+		}
+
+		path = argument;
+	}
+
+	if(path.empty())
 	{
 		std::cout << help << std::endl;
 		return 1;
 	}
 
-	if(argv[1] == "--help")
+	try
 	{
-		std::cout << help << std::endl;
-		return 0;
+		const sys::MappedFile file{path};
+		utils::LogDecoder decoder{output};
+		decoder.Decode(file.GetData(), std::cout);
 	}
+	catch(const std::exception& ex)
+	{
+		std::cout << ex.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	// Run as many jobs as there are cores by default
+	std::size_t jobs = std::max(std::thread::hardware_concurrency(), 1u);
+	bool unity       = false;
+	std::filesystem::path path{};
 
-	// Get the path to the main build file
-	std::filesystem::path path{argv[1]};
+	if(argc > 2 && std::string_view{argv[1]} == "log" && std::string_view{argv[2]} == "decode")
+	{
+		return Decode(argc - 3, argv + 3);
+	}
+
+	for(int i = 1; i < argc; ++i)
+	{
+		const std::string_view argument{argv[i]};
+		if(argument == "--help")
+		{
+			std::cout << help << std::endl;
+			return 0;
+		}
+
+		if(argument == "-j" && i + 1 < argc)
+		{
+			jobs = std::strtoul(argv[++i], nullptr, 10);
+			if(!jobs)
+			{
+				std::cout << help << std::endl;
+				return 1;
+			}
+			continue;
+		}
+
+		if(argument == "--unity")
+		{
+			unity = true;
+			continue;
+		}
+
+		if(argument == "--focus" && i + 1 < argc)
+		{
+			utils::Console::SetFocus(argv[++i]);
+			continue;
+		}
+
+		if((argument == "--log" || argument == "--binary-log") && i + 1 < argc)
+		{
+			const auto sink = argument == "--log" ? utils::Logger::Sink::kText : utils::Logger::Sink::kBinary;
+			utils::Logger::SetFile(argv[++i], sink);
+			continue;
+		}
+
+		// Only one path is expected
+		if(!path.empty())
+		{
+			std::cout << help << std::endl;
+			return 1;
+		}
+
+		// Get the path to the main build file
+		path = argument;
+	}
+
+	if(path.empty())
+	{
+		std::cout << help << std::endl;
+		return 1;
+	}
 
 	// Process the files and build the project
-	Application application;
+	Application application{jobs, unity};
 	application.Process(path);
 	application.Build();
 
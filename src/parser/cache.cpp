@@ -0,0 +1,241 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "parser/cache.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+#include "exceptions/filenotfoundexception.hpp"
+#include "sys/mappedfile.hpp"
+#include "utils/binary.hpp"
+
+namespace parser
+{
+namespace constants
+{
+/**
+ * @brief The signature of the entries, "BBSC" in the little-endian byte order
+ * 
+ */
+constexpr std::uint32_t kMagic = 0x43534242;
+
+/**
+ * @brief The version of the entries' layout, must be bumped on every change of Job
+ * 
+ */
+constexpr std::uint32_t kVersion = 5;
+
+/**
+ * @brief The extension of the entries
+ * 
+ */
+constexpr std::string_view kExtension = ".bin";
+} // namespace constants
+
+using utils::binary::Reader;
+
+namespace
+{
+using Command = scheduler::pipeline::Job::Command;
+using utils::binary::Write;
+
+/**
+ * @brief Append the count-prefixed list of commands to the buffer
+ * 
+ * @param buffer - the buffer to append to
+ * @param commands - the commands to append
+ */
+void Write(std::string& buffer, const std::vector<Command>& commands)
+{
+	Write(buffer, static_cast<std::uint32_t>(commands.size()));
+	for(const auto& command : commands)
+	{
+		Write(buffer, std::string_view{command.line});
+		Write(buffer, command.inputs);
+		Write(buffer, command.outputs);
+		Write(buffer, static_cast<std::uint8_t>(command.serial));
+	}
+}
+
+/**
+ * @brief Read the count-prefixed list of commands
+ * 
+ * @param reader - the reader to read the commands from
+ * @return std::vector<Command> - the commands that were read
+ */
+std::vector<Command> ReadCommands(Reader& reader)
+{
+	const auto size = reader.ReadCount();
+	std::vector<Command> commands{};
+	commands.reserve(size);
+	for(auto count = size; count && reader.IsValid(); --count)
+	{
+		auto& command = commands.emplace_back(Command{std::string{reader.ReadString()}});
+		for(auto& value : reader.ReadStrings())
+		{
+			command.inputs.emplace_back(std::move(value));
+		}
+
+		for(auto& value : reader.ReadStrings())
+		{
+			command.outputs.emplace_back(std::move(value));
+		}
+
+		command.serial = reader.Read<std::uint8_t>() != 0;
+	}
+
+	return commands;
+}
+} // namespace
+
+Cache::Cache(std::filesystem::path directory)
+	: directory_{std::move(directory)}
+{}
+
+std::optional<scheduler::pipeline::Job> Cache::Load(const std::filesystem::path& file) const
+{
+	try
+	{
+		const sys::MappedFile build_file{file};
+		const sys::MappedFile entry{GetEntryPath(file)};
+
+		// The entry is only valid for the exact contents it was created from
+		Reader reader{entry.GetData()};
+		if(reader.Read<std::uint32_t>() != constants::kMagic ||
+		   reader.Read<std::uint32_t>() != constants::kVersion ||
+		   reader.Read<std::uint64_t>() != Hash(build_file.GetData()))
+		{
+			return {};
+		}
+
+		scheduler::pipeline::Job job{std::string{reader.ReadString()}};
+		job.SetCompilationFlags(std::string{reader.ReadString()});
+		// The lists of files might be huge, they are added without intermediate copies
+		const auto files = reader.ReadCount();
+		job.ReserveFiles(files);
+		for(auto count = files; count && reader.IsValid(); --count)
+		{
+			job.AddFile(std::filesystem::path{reader.ReadString()});
+		}
+
+		for(auto& value : reader.ReadStrings())
+		{
+			job.AddDependency(std::move(value));
+		}
+
+		for(auto& value : reader.ReadStrings())
+		{
+			job.AddIncludeDirectory(std::move(value));
+		}
+
+		job.SetPreCompilationCommands(ReadCommands(reader));
+		job.SetPostCompilationCommands(ReadCommands(reader));
+		job.SetPrecompiledHeader(std::filesystem::path{reader.ReadString()});
+		for(auto& value : reader.ReadStrings())
+		{
+			job.AddIsolatedFile(std::move(value));
+		}
+
+		// A truncated entry is treated as a missing one
+		if(!reader.IsValid())
+		{
+			return {};
+		}
+
+		return job;
+	}
+	catch(const ::exceptions::FileNotFoundException&)
+	{
+		return {};
+	}
+}
+
+void Cache::Store(const std::filesystem::path& file, const scheduler::pipeline::Job& job) const
+{
+	std::string buffer{};
+	try
+	{
+		const sys::MappedFile build_file{file};
+		Write(buffer, constants::kMagic);
+		Write(buffer, constants::kVersion);
+		Write(buffer, Hash(build_file.GetData()));
+	}
+	catch(const ::exceptions::FileNotFoundException&)
+	{
+		return;
+	}
+
+	Write(buffer, std::string_view{job.GetProjectName()});
+	Write(buffer, std::string_view{job.GetCompilationFlags()});
+	Write(buffer, job.GetFiles());
+	Write(buffer, job.GetDependencies());
+	Write(buffer, job.GetIncludeDirectories());
+	Write(buffer, job.GetPreCompilationCommands());
+	Write(buffer, job.GetPostCompilationCommands());
+	Write(buffer, std::string_view{job.GetPrecompiledHeader().native()});
+	Write(buffer, job.GetIsolatedFiles());
+
+	std::error_code error{};
+	std::filesystem::create_directories(directory_, error);
+	if(error)
+	{
+		return;
+	}
+
+	// Write to a temporary file first, so a partially written entry is never loaded
+	const auto path = GetEntryPath(file);
+	auto temporary  = path;
+	temporary += ".tmp";
+	{
+		std::ofstream stream{temporary, std::ios::binary | std::ios::trunc};
+		stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+		if(!stream)
+		{
+			std::filesystem::remove(temporary, error);
+			return;
+		}
+	}
+
+	std::filesystem::rename(temporary, path, error);
+}
+
+std::filesystem::path Cache::GetEntryPath(const std::filesystem::path& file) const
+{
+	std::error_code error{};
+	auto absolute = std::filesystem::absolute(file, error);
+	if(error)
+	{
+		absolute = file;
+	}
+
+	std::stringstream name{};
+	name << std::hex << std::setw(16) << std::setfill('0')
+		 << Hash(absolute.lexically_normal().native()) << constants::kExtension;
+	return directory_ / name.str();
+}
+
+std::uint64_t Cache::Hash(std::string_view data)
+{
+	return utils::binary::Hash(data);
+}
+} // namespace parser
\ No newline at end of file
@@ -19,25 +19,26 @@
 
 #include "parser/mediator.hpp"
 
+#include <utility>
+
 #include "parser/exceptions/existingprojectexception.hpp"
 #include "parser/exceptions/nonexistentprojectexception.hpp"
 #include "parser/exceptions/undeclaredvariableexception.hpp"
-#include "parser/states/statement.hpp"
 
 namespace parser
 {
 Mediator::Mediator()
-	: state_{std::make_unique<states::Statement>(*this)}
+	: state_{states::Type::kStatement}
 {}
 
-void Mediator::SetState(std::unique_ptr<states::State> state)
+void Mediator::SetState(states::Type state)
 {
-	state_ = std::move(state);
+	state_ = state;
 }
 
-std::unique_ptr<states::State> Mediator::GetState()
+states::Type Mediator::GetState()
 {
-	return std::move(state_);
+	return std::exchange(state_, states::Type::kNone);
 }
 
 void Mediator::SetJob(std::unique_ptr<scheduler::pipeline::Job> job)
@@ -69,18 +70,19 @@ scheduler::pipeline::Job Mediator::GetJob()
 	return std::move(*job_);
 }
 
-void Mediator::DeclareVariable(std::string id, std::string value)
+void Mediator::DeclareVariable(std::string_view id, std::string_view value)
 {
-	variables_.insert({id, value});
+	variables_.Insert(id, value);
 }
 
-std::string Mediator::GetVariableValue(std::string id) const
+std::string_view Mediator::GetVariableValue(std::string_view id) const
 {
-	if(variables_.find(id) == variables_.end())
+	const auto value = variables_.Find(id);
+	if(!value)
 	{
-		throw exceptions::UndeclaredVariableException(std::move(id));
+		throw exceptions::UndeclaredVariableException(std::string{id});
 	}
 
-	return variables_.at(id);
+	return *value;
 }
 } // namespace parser
\ No newline at end of file
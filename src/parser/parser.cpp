@@ -19,13 +19,42 @@
 
 #include "parser/parser.hpp"
 
-#include "parser/states/state.hpp"
+#include "parser/states/keyword.hpp"
+#include "parser/states/keywords/cflags.hpp"
+#include "parser/states/keywords/deps.hpp"
+#include "parser/states/keywords/files.hpp"
+#include "parser/states/keywords/inc.hpp"
+#include "parser/states/keywords/isolated.hpp"
+#include "parser/states/keywords/let.hpp"
+#include "parser/states/keywords/pch.hpp"
+#include "parser/states/keywords/post.hpp"
+#include "parser/states/keywords/pre.hpp"
+#include "parser/states/keywords/project.hpp"
+#include "parser/states/statement.hpp"
 
 namespace parser
 {
 Parser::Parser(const std::filesystem::path& path)
 	: lexer_{path}
-{}
+{
+	// Construct every state once, so switching between them doesn't allocate
+	const auto set = [this](states::Type type, std::unique_ptr<states::State> state) {
+		states_[static_cast<std::size_t>(type)] = std::move(state);
+	};
+
+	set(states::Type::kStatement, std::make_unique<states::Statement>(mediator_));
+	set(states::Type::kKeyword, std::make_unique<states::Keyword>(mediator_));
+	set(states::Type::kCFlags, std::make_unique<states::keywords::CFlags>(mediator_));
+	set(states::Type::kDeps, std::make_unique<states::keywords::Deps>(mediator_));
+	set(states::Type::kFiles, std::make_unique<states::keywords::Files>(mediator_));
+	set(states::Type::kInc, std::make_unique<states::keywords::Inc>(mediator_));
+	set(states::Type::kIsolated, std::make_unique<states::keywords::Isolated>(mediator_));
+	set(states::Type::kLet, std::make_unique<states::keywords::Let>(mediator_));
+	set(states::Type::kPch, std::make_unique<states::keywords::Pch>(mediator_));
+	set(states::Type::kPost, std::make_unique<states::keywords::Post>(mediator_));
+	set(states::Type::kPre, std::make_unique<states::keywords::Pre>(mediator_));
+	set(states::Type::kProject, std::make_unique<states::keywords::Project>(mediator_));
+}
 
 const lexer::Context& Parser::GetContext() const
 {
@@ -35,9 +64,9 @@ const lexer::Context& Parser::GetContext() const
 scheduler::pipeline::Job Parser::Process()
 {
 	auto state = mediator_.GetState();
-	while(state)
+	while(state != states::Type::kNone)
 	{
-		state->Process(lexer_);
+		GetState(state).Process(lexer_);
 
 		// Get the next state
 		state = mediator_.GetState();
@@ -45,4 +74,9 @@ scheduler::pipeline::Job Parser::Process()
 
 	return mediator_.GetJob();
 }
+
+states::State& Parser::GetState(states::Type type)
+{
+	return *states_[static_cast<std::size_t>(type)];
+}
 } // namespace parser
\ No newline at end of file
@@ -19,16 +19,90 @@
 
 #include "parser/states/keyword.hpp"
 
+#include <array>
+#include <stdexcept>
+#include <string_view>
+
 #include "parser/exceptions/unexpectedendoffileexception.hpp"
 #include "parser/exceptions/unexpectedkeywordexception.hpp"
-#include "parser/states/keywords/cflags.hpp"
-#include "parser/states/keywords/deps.hpp"
-#include "parser/states/keywords/files.hpp"
-#include "parser/states/keywords/inc.hpp"
-#include "parser/states/keywords/let.hpp"
-#include "parser/states/keywords/post.hpp"
-#include "parser/states/keywords/pre.hpp"
-#include "parser/states/keywords/project.hpp"
+
+namespace parser::states::constants
+{
+/**
+ * @brief An entry of the keyword table
+ * 
+ */
+struct Keyword
+{
+	std::string_view keyword;
+	Type state{Type::kNone};
+};
+
+/**
+ * @brief The size of the keyword table, must be a power of two
+ * 
+ */
+inline constexpr std::size_t kTableSize{32};
+
+/**
+ * @brief Hash the keyword, the function is perfect for the known keywords
+ * 
+ * @param keyword - the keyword to hash
+ * @return std::size_t - the index in the keyword table
+ */
+constexpr std::size_t Hash(std::string_view keyword)
+{
+	if(keyword.empty())
+	{
+		return 0;
+	}
+
+	const auto front = static_cast<unsigned char>(keyword.front());
+	const auto back  = static_cast<unsigned char>(keyword.back());
+	return (keyword.size() + front + 2 * back) & (kTableSize - 1);
+}
+
+/**
+ * @brief Build the keyword table, a collision stops the compilation
+ * 
+ * @return std::array<Keyword, kTableSize> - the keyword table
+ */
+constexpr std::array<Keyword, kTableSize> MakeKeywordTable()
+{
+	constexpr Keyword keywords[]{
+		{"cflags", Type::kCFlags},
+		{"deps", Type::kDeps},
+		{"files", Type::kFiles},
+		{"inc", Type::kInc},
+		{"isolated", Type::kIsolated},
+		{"let", Type::kLet},
+		{"pch", Type::kPch},
+		{"post", Type::kPost},
+		{"pre", Type::kPre},
+		{"prj", Type::kProject},
+	};
+
+	std::array<Keyword, kTableSize> table{};
+	for(const auto& entry : keywords)
+	{
+		auto& slot = table[Hash(entry.keyword)];
+		if(!slot.keyword.empty())
+		{
+			throw std::logic_error("keyword hash collision");
+		}
+
+		slot = entry;
+	}
+
+	return table;
+}
+
+/**
+ * @brief The table used to map keywords onto the parser's states
+ * 
+ */
+inline constexpr auto kKeywordTable{MakeKeywordTable()};
+} // namespace parser::states::constants
 
 namespace parser::states
 {
@@ -46,48 +120,14 @@ void Keyword::Process(lexer::Lexer& lexer)
 	}
 
 	// Process the correct keyword
-	const auto& keyword = token->GetValue();
-	if(keyword == "cflags")
-	{
-		mediator_.SetState(std::make_unique<keywords::CFlags>(mediator_));
-		return;
-	}
-	else if(keyword == "deps")
-	{
-		mediator_.SetState(std::make_unique<keywords::Deps>(mediator_));
-		return;
-	}
-	else if(keyword == "files")
-	{
-		mediator_.SetState(std::make_unique<keywords::Files>(mediator_));
-		return;
-	}
-	else if(keyword == "prj")
-	{
-		mediator_.SetState(std::make_unique<keywords::Project>(mediator_));
-		return;
-	}
-	else if(keyword == "pre")
-	{
-		mediator_.SetState(std::make_unique<keywords::Pre>(mediator_));
-		return;
-	}
-	else if(keyword == "post")
-	{
-		mediator_.SetState(std::make_unique<keywords::Post>(mediator_));
-		return;
-	}
-	else if(keyword == "let")
-	{
-		mediator_.SetState(std::make_unique<keywords::Let>(mediator_));
-		return;
-	}
-	else if(keyword == "inc")
+	const auto keyword = token->value;
+	const auto& entry  = constants::kKeywordTable[constants::Hash(keyword)];
+	if(!entry.keyword.empty() && entry.keyword == keyword)
 	{
-		mediator_.SetState(std::make_unique<keywords::Inc>(mediator_));
+		mediator_.SetState(entry.state);
 		return;
 	}
 
-	throw exceptions::UnexpectedKeywordException(lexer.GetContext(), token->GetValue());
+	throw exceptions::UnexpectedKeywordException(lexer.GetContext(), std::string{keyword});
 }
 } // namespace parser::states
\ No newline at end of file
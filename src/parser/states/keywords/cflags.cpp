@@ -19,8 +19,6 @@
 
 #include "parser/states/keywords/cflags.hpp"
 
-#include "parser/states/statement.hpp"
-
 namespace parser::states::keywords
 {
 CFlags::CFlags(Mediator& mediator)
@@ -36,6 +34,6 @@ void CFlags::Process(lexer::Lexer& lexer)
 	job.SetCompilationFlags(std::move(GetValue()));
 
 	// Return to the Statement state
-	mediator_.SetState(std::make_unique<Statement>(mediator_));
+	mediator_.SetState(Type::kStatement);
 }
 } // namespace parser::states::keywords
\ No newline at end of file
@@ -19,8 +19,6 @@
 
 #include "parser/states/keywords/deps.hpp"
 
-#include "parser/states/statement.hpp"
-
 namespace parser::states::keywords
 {
 Deps::Deps(Mediator& mediator)
@@ -29,16 +27,15 @@ Deps::Deps(Mediator& mediator)
 
 void Deps::Process(lexer::Lexer& lexer)
 {
+	// The elements are added to the job by Add()
 	Array::Process(lexer);
 
-	// Set the job's files
-	auto& job = mediator_.BorrowJob();
-	for(auto& name : Array::GetValue())
-	{
-		job.AddDependency(std::filesystem::path{name});
-	}
-
 	// Return to the Statement state
-	mediator_.SetState(std::make_unique<Statement>(mediator_));
+	mediator_.SetState(Type::kStatement);
+}
+
+void Deps::Add(std::string value)
+{
+	mediator_.BorrowJob().AddDependency(std::filesystem::path{std::move(value)});
 }
 } // namespace parser::states::keywords
\ No newline at end of file
@@ -19,8 +19,6 @@
 
 #include "parser/states/keywords/inc.hpp"
 
-#include "parser/states/statement.hpp"
-
 namespace parser::states::keywords
 {
 Inc::Inc(Mediator& mediator)
@@ -29,16 +27,15 @@ Inc::Inc(Mediator& mediator)
 
 void Inc::Process(lexer::Lexer& lexer)
 {
+	// The elements are added to the job by Add()
 	Array::Process(lexer);
 
-	// Set the job's Inc
-	auto& job = mediator_.BorrowJob();
-	for(auto& name : Array::GetValue())
-	{
-		job.AddIncludeDirectory(std::filesystem::path{name});
-	}
-
 	// Return to the Statement state
-	mediator_.SetState(std::make_unique<Statement>(mediator_));
+	mediator_.SetState(Type::kStatement);
+}
+
+void Inc::Add(std::string value)
+{
+	mediator_.BorrowJob().AddIncludeDirectory(std::filesystem::path{std::move(value)});
 }
 } // namespace parser::states::keywords
\ No newline at end of file
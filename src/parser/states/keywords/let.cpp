@@ -20,8 +20,6 @@
 #include "parser/states/keywords/let.hpp"
 
 #include "parser/exceptions/unexpectedtokenexception.hpp"
-#include "parser/states/statement.hpp"
-#include "parser/tokens/word.hpp"
 
 namespace parser::states::keywords
 {
@@ -39,28 +37,27 @@ void Let::Process(lexer::Lexer& lexer)
 	}
 
 	// The first element is a word
-	const auto ptr = dynamic_cast<tokens::Word*>(token.get());
-	if(!ptr)
+	if(token->kind != tokens::Lexeme::Kind::kWord)
 	{
 		// FIXME: use context
 		throw exceptions::UnexpectedTokenException("");
 	}
 
-	std::string id = token->GetValue();
+	std::string id{token->value};
 
 	// Check if the assignment symbol is there
 	token = State::SkipSeparators(lexer);
-	Match(token.get(), tokens::Operator::Type::kEqualitySign);
+	Match(token, tokens::Operator::Type::kEqualitySign);
 
 	// Process variable's value
 	String::Process(lexer);
 
 	// Update the data inside the mediator
-	mediator_.DeclareVariable(std::move(id), std::move(GetValue()));
-	mediator_.SetState(std::make_unique<Statement>(mediator_));
+	mediator_.DeclareVariable(id, GetValue());
+	mediator_.SetState(Type::kStatement);
 }
 
-void Let::Match(tokens::Token* token, tokens::Operator::Type value)
+void Let::Match(const tokens::Lexeme* token, tokens::Operator::Type value)
 {
 	if(!token)
 	{
@@ -68,8 +65,7 @@ void Let::Match(tokens::Token* token, tokens::Operator::Type value)
 		throw exceptions::UnexpectedTokenException("EOF");
 	}
 
-	const auto ptr = dynamic_cast<tokens::Operator*>(token);
-	if(!ptr || ptr->type != value)
+	if(!Is(token, value))
 	{
 		// FIXME: use context
 		throw exceptions::UnexpectedTokenException("");
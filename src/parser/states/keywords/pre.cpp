@@ -19,23 +19,21 @@
 
 #include "parser/states/keywords/pre.hpp"
 
-#include "parser/states/statement.hpp"
-
 namespace parser::states::keywords
 {
 Pre::Pre(Mediator& mediator)
-	: Array{mediator}
+	: Commands{mediator}
 {}
 
 void Pre::Process(lexer::Lexer& lexer)
 {
-	Array::Process(lexer);
+	Commands::Process(lexer);
 
 	// Set the compilation flags
 	auto& job = mediator_.BorrowJob();
-	job.SetPreCompilationCommands(std::move(GetValue()));
+	job.SetPreCompilationCommands(GetCommands());
 
 	// Return to the Statement state
-	mediator_.SetState(std::make_unique<Statement>(mediator_));
+	mediator_.SetState(Type::kStatement);
 }
 } // namespace parser::states::keywords
\ No newline at end of file
@@ -19,8 +19,6 @@
 
 #include "parser/states/keywords/project.hpp"
 
-#include "parser/states/statement.hpp"
-
 namespace parser::states::keywords
 {
 Project::Project(Mediator& mediator)
@@ -35,6 +33,6 @@ void Project::Process(lexer::Lexer& lexer)
 	mediator_.SetJob(std::make_unique<scheduler::pipeline::Job>(std::move(GetValue())));
 
 	// Return to the Statement state
-	mediator_.SetState(std::make_unique<Statement>(mediator_));
+	mediator_.SetState(Type::kStatement);
 }
 } // namespace parser::states::keywords
\ No newline at end of file
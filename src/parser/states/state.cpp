@@ -20,7 +20,6 @@
 #include "parser/states/state.hpp"
 
 #include "parser/exceptions/unexpectedtokenexception.hpp"
-#include "parser/tokens/separator.hpp"
 
 namespace parser::states
 {
@@ -28,18 +27,12 @@ State::State(Mediator& mediator)
 	: mediator_{mediator}
 {}
 
-std::shared_ptr<tokens::Token> State::SkipSeparators(lexer::Lexer& lexer)
+const tokens::Lexeme* State::SkipSeparators(lexer::Lexer& lexer)
 {
-	std::shared_ptr<tokens::Token> token;
+	const tokens::Lexeme* token;
 	while((token = lexer.Next()))
 	{
-		// Token might be nullptr, handle this case
-		if(!token)
-		{
-			throw std::runtime_error("State::SkipSeparators() was called with nullptr.");
-		}
-
-		if(!dynamic_cast<tokens::Separator*>(token.get()))
+		if(token->kind != tokens::Lexeme::Kind::kSeparator)
 		{
 			break;
 		}
@@ -48,7 +41,7 @@ std::shared_ptr<tokens::Token> State::SkipSeparators(lexer::Lexer& lexer)
 	return token;
 }
 
-void State::Match(tokens::Token* token, tokens::Punctuator::Type value)
+void State::Match(const tokens::Lexeme* token, tokens::Punctuator::Type value)
 {
 	if(!token)
 	{
@@ -56,10 +49,21 @@ void State::Match(tokens::Token* token, tokens::Punctuator::Type value)
 		throw exceptions::UnexpectedTokenException("EOF");
 	}
 
-	const auto ptr = dynamic_cast<tokens::Punctuator*>(token);
-	if(!ptr || ptr->type != value)
+	if(!Is(token, value))
 	{
-		throw exceptions::UnexpectedTokenException(std::move(token->GetValue()));
+		throw exceptions::UnexpectedTokenException(std::string{token->value});
 	}
 }
+
+bool State::Is(const tokens::Lexeme* token, tokens::Punctuator::Type value)
+{
+	return token && token->kind == tokens::Lexeme::Kind::kPunctuator &&
+		   token->subtype == static_cast<uint8_t>(value);
+}
+
+bool State::Is(const tokens::Lexeme* token, tokens::Operator::Type value)
+{
+	return token && token->kind == tokens::Lexeme::Kind::kOperator &&
+		   token->subtype == static_cast<uint8_t>(value);
+}
 } // namespace parser::states
\ No newline at end of file
@@ -19,8 +19,6 @@
 
 #include "parser/states/statement.hpp"
 
-#include "parser/states/keyword.hpp"
-
 namespace parser::states
 {
 Statement::Statement(Mediator& mediator)
@@ -33,14 +31,14 @@ void Statement::Process(lexer::Lexer& lexer)
 	auto token = State::SkipSeparators(lexer);
 	if(!token)
 	{
-		mediator_.SetState({});
+		mediator_.SetState(Type::kNone);
 		return;
 	}
 
 	// Every statement begins with the exclamation mark
-	Match(token.get(), tokens::Punctuator::Type::kExclamationMark);
+	Match(token, tokens::Punctuator::Type::kExclamationMark);
 
 	// By default, statements start with keywords
-	mediator_.SetState(std::make_unique<Keyword>(mediator_));
+	mediator_.SetState(Type::kKeyword);
 }
 } // namespace parser::states
\ No newline at end of file
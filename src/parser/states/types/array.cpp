@@ -31,11 +31,14 @@ Array::Array(Mediator& mediator)
 
 void Array::Process(lexer::Lexer& lexer)
 {
+	// The state is reused, drop the previous value
+	value_.clear();
+
 	// Skip separators in between the keyword and the
 	auto token = SkipSeparators(lexer);
 
 	// Expect the bracket at the start of the string
-	Match(token.get(), tokens::Punctuator::Type::kLeftSquareBracket);
+	Match(token, tokens::Punctuator::Type::kLeftSquareBracket);
 
 	// Process the tokens
 	String string_handler{mediator_};
@@ -43,29 +46,35 @@ void Array::Process(lexer::Lexer& lexer)
 	{
 		// Get the next string
 		string_handler.Process(lexer);
-		value_.push_back(string_handler.GetValue());
-		string_handler.Clear();
+		Add(string_handler.GetValue());
 
-		// Get the terminator token
-		token = SkipSeparators(lexer);
+		// Get the terminator token, following the clauses of the element
+		token = ProcessClauses(lexer, SkipSeparators(lexer));
 
-		// Try to match any punctuator
-		try
+		// The closing bracket ends the array, otherwise a comma is expected
+		if(Is(token, tokens::Punctuator::Type::kRightSquareBracket))
 		{
-			Match(token.get(), tokens::Punctuator::Type::kRightSquareBracket);
 			return;
 		}
-		catch(const exceptions::UnexpectedTokenException&)
-		{
-			Match(token.get(), tokens::Punctuator::Type::kComma);
-		}
+
+		Match(token, tokens::Punctuator::Type::kComma);
 	} while(token);
 
 	throw exceptions::UnexpectedEndOfFileException(lexer.GetContext());
 }
 
-std::vector<std::string> Array::GetValue() const
+const std::vector<std::string>& Array::GetValue() const
 {
 	return value_;
 }
+
+void Array::Add(std::string value)
+{
+	value_.push_back(std::move(value));
+}
+
+const tokens::Lexeme* Array::ProcessClauses(lexer::Lexer&, const tokens::Lexeme* token)
+{
+	return token;
+}
 } // namespace parser::states::types
\ No newline at end of file
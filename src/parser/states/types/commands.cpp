@@ -0,0 +1,99 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "parser/states/types/commands.hpp"
+
+namespace parser::states::types
+{
+namespace constants
+{
+/**
+ * @brief The word that starts the list of the files the command reads
+ * 
+ */
+constexpr std::string_view kInputs = "in";
+
+/**
+ * @brief The word that starts the list of the files the command creates
+ * 
+ */
+constexpr std::string_view kOutputs = "out";
+
+/**
+ * @brief The word that makes the command wait for all the commands before it
+ * 
+ */
+constexpr std::string_view kSerial = "serial";
+} // namespace constants
+
+Commands::Commands(Mediator& mediator)
+	: Array{mediator}
+{}
+
+void Commands::Process(lexer::Lexer& lexer)
+{
+	// The state is reused, drop the previous value
+	commands_.clear();
+
+	Array::Process(lexer);
+}
+
+const std::vector<scheduler::pipeline::Job::Command>& Commands::GetCommands() const
+{
+	return commands_;
+}
+
+void Commands::Add(std::string value)
+{
+	commands_.push_back({std::move(value)});
+}
+
+const tokens::Lexeme* Commands::ProcessClauses(lexer::Lexer& lexer, const tokens::Lexeme* token)
+{
+	// Both of the lists are optional, but the inputs go first
+	for(const auto& [word, files] : {std::make_pair(constants::kInputs, &commands_.back().inputs),
+									 std::make_pair(constants::kOutputs, &commands_.back().outputs)})
+	{
+		if(!IsWord(token, word))
+		{
+			continue;
+		}
+
+		Array array{mediator_};
+		array.Process(lexer);
+		files->assign(array.GetValue().begin(), array.GetValue().end());
+
+		token = SkipSeparators(lexer);
+	}
+
+	// The commands are run concurrently, unless marked otherwise
+	if(IsWord(token, constants::kSerial))
+	{
+		commands_.back().serial = true;
+		token = SkipSeparators(lexer);
+	}
+
+	return token;
+}
+
+bool Commands::IsWord(const tokens::Lexeme* token, std::string_view value)
+{
+	return token && token->kind == tokens::Lexeme::Kind::kWord && token->value == value;
+}
+} // namespace parser::states::types
@@ -31,43 +31,43 @@ String::String(Mediator& mediator)
 
 void String::Process(lexer::Lexer& lexer)
 {
+	// The state is reused, drop the previous value
+	Clear();
+
 	// Skip separators in between the keyword and the
 	auto token = State::SkipSeparators(lexer);
 
 	// Expect the double quote mark at the start of the string
-	Match(token.get(), ::parser::tokens::Punctuator::Type::kDoubleQuoteMark);
+	Match(token, ::parser::tokens::Punctuator::Type::kDoubleQuoteMark);
 
 	// Add tokens one by one to the internal buffer
 	while((token = lexer.Next()))
 	{
-		try
+		// The closing quote mark ends the string
+		if(Is(token, tokens::Punctuator::Type::kDoubleQuoteMark))
 		{
-			Match(token.get(), tokens::Punctuator::Type::kDoubleQuoteMark);
 			return;
 		}
-		catch(const exceptions::UnexpectedTokenException&)
-		{
-			auto ptr = dynamic_cast<tokens::Operator*>(token.get());
-			if(ptr && ptr->type == tokens::Operator::Type::kDollarSign)
-			{
-				Variable variable{mediator_};
-				variable.Process(lexer);
 
-				// Add variable's value to the result
-				value_ += variable.GetValue();
+		if(Is(token, tokens::Operator::Type::kDollarSign))
+		{
+			Variable variable{mediator_};
+			variable.Process(lexer);
 
-				continue;
-			}
+			// Expand the variable straight into the result
+			value_.append(variable.GetValue());
 
-			// Add the token to the whole value
-			value_ += token->GetValue();
+			continue;
 		}
+
+		// Add the token to the whole value
+		value_.append(token->value);
 	}
 
 	throw exceptions::UnexpectedTokenException("");
 }
 
-std::string String::GetValue() const
+const std::string& String::GetValue() const
 {
 	return value_;
 }
@@ -0,0 +1,102 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "parser/symboltable.hpp"
+
+#include <functional>
+
+namespace parser
+{
+namespace constants
+{
+constexpr std::size_t kInitialSlots = 16;
+} // namespace constants
+
+bool SymbolTable::Insert(std::string_view name, std::string_view value)
+{
+	// Keep at least half of the slots free, so the probe sequences stay short
+	if((size_ + 1) * 2 > slots_.size())
+	{
+		Grow();
+	}
+
+	auto& slot = slots_[Probe(name)];
+	if(slot.used)
+	{
+		return false;
+	}
+
+	slot = {Intern(name), Intern(value), true};
+	++size_;
+	return true;
+}
+
+std::optional<std::string_view> SymbolTable::Find(std::string_view name) const
+{
+	if(slots_.empty())
+	{
+		return {};
+	}
+
+	const auto& slot = slots_[Probe(name)];
+	if(!slot.used)
+	{
+		return {};
+	}
+
+	return slot.value;
+}
+
+std::size_t SymbolTable::GetSize() const
+{
+	return size_;
+}
+
+std::size_t SymbolTable::Probe(std::string_view name) const
+{
+	const auto mask = slots_.size() - 1;
+	auto index = std::hash<std::string_view>{}(name) & mask;
+	while(slots_[index].used && slots_[index].name != name)
+	{
+		index = (index + 1) & mask;
+	}
+
+	return index;
+}
+
+void SymbolTable::Grow()
+{
+	auto slots = std::move(slots_);
+	slots_.assign(slots.empty() ? constants::kInitialSlots : slots.size() * 2, Slot{});
+
+	// The interned strings are not moved, only the views are redistributed
+	for(const auto& slot : slots)
+	{
+		if(slot.used)
+		{
+			slots_[Probe(slot.name)] = slot;
+		}
+	}
+}
+
+std::string_view SymbolTable::Intern(std::string_view value)
+{
+	return strings_.emplace_back(value);
+}
+} // namespace parser
\ No newline at end of file
@@ -38,4 +38,13 @@ std::string Operator::GetValue() const
 									   [&](const auto& pair) { return pair.second == type; });
 	return std::string(1, iterator->first);
 }
+
+Lexeme Operator::ToLexeme() const
+{
+	// The keys of the map live as long as the program does
+	const auto iterator = std::find_if(kOperatorToTypeMap.begin(),
+									   kOperatorToTypeMap.end(),
+									   [&](const auto& pair) { return pair.second == type; });
+	return {Lexeme::Kind::kOperator, static_cast<uint8_t>(type), {&iterator->first, 1}};
+}
 } // namespace parser::tokens
\ No newline at end of file
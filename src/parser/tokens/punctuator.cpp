@@ -32,7 +32,9 @@ const std::map<char, Punctuator::Type> Punctuator::kPunctuatorToTypeMap{
 	{',', Type::kComma},
 	{'/', Type::kSlash},
 	{'\\', Type::kBackslash},
-	{'-', Type::kMinus}};
+	{'-', Type::kMinus},
+	{'*', Type::kAsterisk},
+	{'?', Type::kQuestionMark}};
 
 Punctuator::Punctuator(Type type_)
 	: Token{}
@@ -46,4 +48,13 @@ std::string Punctuator::GetValue() const
 									   [&](const auto& pair) { return pair.second == type; });
 	return std::string(1, iterator->first);
 }
+
+Lexeme Punctuator::ToLexeme() const
+{
+	// The keys of the map live as long as the program does
+	const auto iterator = std::find_if(kPunctuatorToTypeMap.begin(),
+									   kPunctuatorToTypeMap.end(),
+									   [&](const auto& pair) { return pair.second == type; });
+	return {Lexeme::Kind::kPunctuator, static_cast<uint8_t>(type), {&iterator->first, 1}};
+}
 } // namespace parser::tokens
\ No newline at end of file
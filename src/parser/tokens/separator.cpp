@@ -37,4 +37,13 @@ std::string Separator::GetValue() const
 									   [&](const auto& pair) { return pair.second == type; });
 	return std::string(1, iterator->first);
 }
+
+Lexeme Separator::ToLexeme() const
+{
+	// The keys of the map live as long as the program does
+	const auto iterator = std::find_if(kSeparatorToTypeMap.begin(),
+									   kSeparatorToTypeMap.end(),
+									   [&](const auto& pair) { return pair.second == type; });
+	return {Lexeme::Kind::kSeparator, static_cast<uint8_t>(type), {&iterator->first, 1}};
+}
 } // namespace parser::tokens
\ No newline at end of file
@@ -21,6 +21,10 @@
 
 namespace scheduler
 {
+Executor::Executor(std::size_t jobs)
+	: pool_{jobs}
+{}
+
 void Executor::Add(pipeline::Pipeline pipeline)
 {
 	pipelines_.push(std::move(pipeline));
@@ -32,7 +36,7 @@ void Executor::Run()
 	{
 		// Run the pipeline
 		const auto pipeline = std::move(pipelines_.front());
-		pipeline.Run();
+		pipeline.Run(pool_);
 
 		// Pop the pipeline from the queue
 		pipelines_.pop();
@@ -0,0 +1,74 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "scheduler/graph.hpp"
+
+namespace scheduler
+{
+Graph::Id Graph::Add(std::function<void()> task)
+{
+	nodes_.emplace_back().task = std::move(task);
+	return nodes_.size() - 1;
+}
+
+void Graph::AddDependency(Id node, Id dependency)
+{
+	nodes_.at(dependency).dependents.push_back(node);
+	++nodes_.at(node).remaining;
+}
+
+void Graph::Run(ThreadPool& pool)
+{
+	// The roots are collected first, as the nodes start to update the counters once submitted
+	std::vector<Id> roots{};
+	for(Id node = 0; node < nodes_.size(); ++node)
+	{
+		if(nodes_[node].remaining == 0)
+		{
+			roots.push_back(node);
+		}
+	}
+
+	for(const auto node : roots)
+	{
+		Submit(pool, node);
+	}
+}
+
+std::size_t Graph::GetSize() const
+{
+	return nodes_.size();
+}
+
+void Graph::Submit(ThreadPool& pool, Id node)
+{
+	pool.Submit([this, &pool, node] {
+		nodes_[node].task();
+
+		// The last of the dependencies to finish submits the dependent node
+		for(const auto dependent : nodes_[node].dependents)
+		{
+			if(--nodes_[dependent].remaining == 0)
+			{
+				Submit(pool, dependent);
+			}
+		}
+	});
+}
+} // namespace scheduler
\ No newline at end of file
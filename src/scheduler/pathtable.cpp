@@ -0,0 +1,126 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "scheduler/pathtable.hpp"
+
+#include <mutex>
+
+namespace scheduler
+{
+namespace constants
+{
+/**
+ * @brief The extension of the object files
+ * 
+ */
+constexpr std::string_view kObjectExtension = ".o";
+} // namespace constants
+
+PathTable& PathTable::GetInstance()
+{
+	static PathTable instance{};
+	return instance;
+}
+
+PathTable::Id PathTable::Intern(const std::filesystem::path& path)
+{
+	{
+		std::shared_lock lock{mutex_};
+		const auto iterator = ids_.find(path.native());
+		if(iterator != ids_.end())
+		{
+			return iterator->second;
+		}
+	}
+
+	// Another thread might have interned the path in between the locks
+	std::unique_lock lock{mutex_};
+	const auto iterator = ids_.find(path.native());
+	if(iterator != ids_.end())
+	{
+		return iterator->second;
+	}
+
+	const auto id     = static_cast<Id>(entries_.size());
+	const auto& entry = entries_.emplace_back(Entry{path, {}, {}});
+	ids_.emplace(entry.path.native(), id);
+	return id;
+}
+
+const std::filesystem::path& PathTable::GetPath(Id id) const
+{
+	std::shared_lock lock{mutex_};
+	return entries_.at(id).path;
+}
+
+const std::filesystem::path& PathTable::GetObjectName(Id id)
+{
+	{
+		std::shared_lock lock{mutex_};
+		const auto& entry = entries_.at(id);
+		if(entry.object)
+		{
+			return *entry.object;
+		}
+	}
+
+	std::unique_lock lock{mutex_};
+	auto& entry = entries_.at(id);
+	if(!entry.object)
+	{
+		entry.object = entry.path.filename().replace_extension(constants::kObjectExtension);
+	}
+
+	return *entry.object;
+}
+
+std::filesystem::file_time_type PathTable::GetWriteTime(Id id)
+{
+	{
+		std::shared_lock lock{mutex_};
+		const auto& entry = entries_.at(id);
+		if(entry.time)
+		{
+			return *entry.time;
+		}
+	}
+
+	// The file system is queried without the lock, a concurrent query gets the same time
+	const auto time = std::filesystem::last_write_time(GetPath(id));
+
+	std::unique_lock lock{mutex_};
+	entries_.at(id).time = time;
+	return time;
+}
+
+void PathTable::ResetWriteTimes()
+{
+	std::unique_lock lock{mutex_};
+	for(auto& entry : entries_)
+	{
+		entry.time.reset();
+	}
+}
+
+std::size_t PathTable::GetSize() const
+{
+	std::shared_lock lock{mutex_};
+	return entries_.size();
+}
+} // namespace scheduler
\ No newline at end of file
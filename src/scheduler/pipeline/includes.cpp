@@ -0,0 +1,206 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "scheduler/pipeline/includes.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace scheduler::pipeline
+{
+namespace constants
+{
+/**
+ * @brief The name of the generated header
+ * 
+ */
+constexpr std::string_view kHeader = "auto.hpp";
+
+/**
+ * @brief The name of the file with the sizes of the headers
+ * 
+ */
+constexpr std::string_view kSizes = "auto.sizes";
+
+/**
+ * @brief The first line of the generated header
+ * 
+ */
+constexpr std::string_view kPreamble = "// Generated by bbs from the headers, included by every file\n";
+
+/**
+ * @brief The extensions of the headers, that might be included at the start of any file
+ * 
+ */
+constexpr std::array<std::string_view, 4> kExtensions{".h", ".hh", ".hpp", ".hxx"};
+
+/**
+ * @brief The preprocessed size, starting from which the header is worth precompiling
+ * 
+ */
+constexpr std::size_t kMinimumSize = 64 * 1024;
+
+/**
+ * @brief The maximum number of the selected headers
+ * 
+ */
+constexpr std::size_t kMaximumHeaders = 8;
+} // namespace constants
+
+Includes::Includes(const std::filesystem::path& directory)
+	: header_{directory / constants::kHeader}
+	, sizes_{directory / constants::kSizes}
+{}
+
+void Includes::Add(const std::vector<std::filesystem::path>& dependencies)
+{
+	std::unique_lock<std::mutex> lock{mutex_};
+	for(const auto& dependency : dependencies)
+	{
+		const auto extension = dependency.extension().native();
+		if(std::find(constants::kExtensions.begin(), constants::kExtensions.end(), extension) !=
+		   constants::kExtensions.end())
+		{
+			++counts_[dependency.lexically_normal()];
+		}
+	}
+
+	++files_;
+}
+
+bool Includes::Update(std::size_t files, const Weigh& weigh)
+{
+	std::unique_lock<std::mutex> lock{mutex_};
+
+	// Some of the files were compiled, so their headers weren't checked, the selection is kept
+	if(!files_ || files_ < files)
+	{
+		return false;
+	}
+
+	// Measuring a header means preprocessing it, so the sizes are reused by the next builds
+	auto sizes    = ReadSizes();
+	bool measured = false;
+	std::vector<std::pair<std::size_t, std::filesystem::path>> candidates{};
+	for(const auto& [header, count] : counts_)
+	{
+		// The header is included into every file, so it must be one, that every file includes already
+		if(count < files_)
+		{
+			continue;
+		}
+
+		auto size = sizes.find(header);
+		if(size == sizes.end())
+		{
+			size     = sizes.emplace(header, weigh(header)).first;
+			measured = true;
+		}
+
+		// The headers are weighed by how much parsing the precompilation saves
+		if(size->second >= constants::kMinimumSize)
+		{
+			candidates.emplace_back(count * size->second, header);
+		}
+	}
+
+	if(measured)
+	{
+		WriteSizes(sizes);
+	}
+
+	std::sort(candidates.begin(), candidates.end(), std::greater<>{});
+	candidates.resize(std::min(candidates.size(), constants::kMaximumHeaders));
+
+	// Nothing is worth precompiling, the generated header is removed
+	std::error_code error{};
+	if(candidates.empty())
+	{
+		return std::filesystem::remove(header_, error);
+	}
+
+	std::string content{constants::kPreamble};
+	for(const auto& candidate : candidates)
+	{
+		content.append("#include \"")
+			.append(std::filesystem::absolute(candidate.second).lexically_normal().string())
+			.append("\"\n");
+	}
+
+	// The header is only rewritten if the selection is changed, as it makes every file to be compiled again
+	std::ifstream stream{header_};
+	if(std::string{std::istreambuf_iterator<char>{stream}, {}} == content)
+	{
+		return false;
+	}
+
+	std::filesystem::create_directories(header_.parent_path(), error);
+	std::ofstream{header_, std::ios::trunc} << content;
+	return true;
+}
+
+const std::filesystem::path& Includes::GetHeader() const
+{
+	return header_;
+}
+
+std::map<std::filesystem::path, std::size_t> Includes::ReadSizes() const
+{
+	std::error_code error{};
+	const auto time = std::filesystem::last_write_time(sizes_, error);
+	if(error)
+	{
+		return {};
+	}
+
+	// Every line holds the size, followed by the header
+	std::map<std::filesystem::path, std::size_t> sizes{};
+	std::ifstream stream{sizes_};
+	std::size_t size{};
+	std::string header{};
+	while(stream >> size && std::getline(stream >> std::ws, header))
+	{
+		// The header might have been changed after it was measured
+		const auto modified = std::filesystem::last_write_time(header, error);
+		if(!error && modified <= time)
+		{
+			sizes.emplace(header, size);
+		}
+	}
+
+	return sizes;
+}
+
+void Includes::WriteSizes(const std::map<std::filesystem::path, std::size_t>& sizes) const
+{
+	std::error_code error{};
+	std::filesystem::create_directories(sizes_.parent_path(), error);
+
+	std::ofstream stream{sizes_, std::ios::trunc};
+	for(const auto& [header, size] : sizes)
+	{
+		stream << size << ' ' << header.string() << '\n';
+	}
+}
+} // namespace scheduler::pipeline
\ No newline at end of file
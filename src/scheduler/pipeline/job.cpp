@@ -45,6 +45,16 @@ void Job::AddFile(std::filesystem::path value)
 	files_.push_back(std::move(value));
 }
 
+void Job::SetFiles(std::vector<std::filesystem::path> value)
+{
+	files_ = std::move(value);
+}
+
+void Job::ReserveFiles(std::size_t count)
+{
+	files_.reserve(count);
+}
+
 const std::vector<std::filesystem::path>& Job::GetFiles() const
 {
 	return files_;
@@ -70,22 +80,22 @@ const std::string& Job::GetCompilationFlags() const
 	return cflags_;
 }
 
-void Job::SetPreCompilationCommands(std::vector<std::string> value)
+void Job::SetPreCompilationCommands(std::vector<Command> value)
 {
 	pre_commands_ = std::move(value);
 }
 
-const std::vector<std::string>& Job::GetPreCompilationCommands() const
+const std::vector<Job::Command>& Job::GetPreCompilationCommands() const
 {
 	return pre_commands_;
 }
 
-void Job::SetPostCompilationCommands(std::vector<std::string> value)
+void Job::SetPostCompilationCommands(std::vector<Command> value)
 {
 	post_commands_ = std::move(value);
 }
 
-const std::vector<std::string>& Job::GetPostCompilationCommands() const
+const std::vector<Job::Command>& Job::GetPostCompilationCommands() const
 {
 	return post_commands_;
 }
@@ -99,4 +109,24 @@ const std::vector<std::filesystem::path>& Job::GetIncludeDirectories() const
 {
 	return include_directories_;
 }
+
+void Job::SetPrecompiledHeader(std::filesystem::path value)
+{
+	precompiled_header_ = std::move(value);
+}
+
+const std::filesystem::path& Job::GetPrecompiledHeader() const
+{
+	return precompiled_header_;
+}
+
+void Job::AddIsolatedFile(std::filesystem::path value)
+{
+	isolated_files_.push_back(std::move(value));
+}
+
+const std::vector<std::filesystem::path>& Job::GetIsolatedFiles() const
+{
+	return isolated_files_;
+}
 } // namespace scheduler::pipeline
\ No newline at end of file
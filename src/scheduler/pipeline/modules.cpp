@@ -0,0 +1,329 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "scheduler/pipeline/modules.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include <utility>
+
+#include "utils/binary.hpp"
+
+namespace scheduler::pipeline
+{
+namespace constants
+{
+/**
+ * @brief The signature of the modules' cache, "BBSM" in the little-endian byte order
+ * 
+ */
+constexpr std::uint32_t kMagic = 0x4D534242;
+
+/**
+ * @brief The version of the modules' cache layout
+ * 
+ */
+constexpr std::uint32_t kVersion = 1;
+
+/**
+ * @brief The keyword, that marks the declaration as exported
+ * 
+ */
+constexpr std::string_view kExport = "export";
+
+/**
+ * @brief The keyword, that declares a module
+ * 
+ */
+constexpr std::string_view kModule = "module";
+
+/**
+ * @brief The keyword, that imports a module
+ * 
+ */
+constexpr std::string_view kImport = "import";
+} // namespace constants
+
+namespace
+{
+/**
+ * @brief Check if the character can be a part of an identifier
+ * 
+ * @param character - the character to check
+ * @return true if it's a letter, a digit or an underscore, false otherwise
+ */
+bool IsIdentifier(char character)
+{
+	return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+} // namespace
+
+using utils::binary::Reader;
+using utils::binary::Write;
+
+Modules::Modules(std::filesystem::path cache)
+	: cache_{std::move(cache)}
+{
+	Load();
+}
+
+Modules::Unit Modules::Find(const std::filesystem::path& file)
+{
+	// A file, that can't be read, has no modules, and is scanned again by the next build
+	std::error_code error{};
+	const auto time = std::filesystem::last_write_time(file, error);
+	if(error)
+	{
+		return Scan(file);
+	}
+
+	const auto stamp  = static_cast<std::int64_t>(time.time_since_epoch().count());
+	const auto cached = cached_.find(file.native());
+	auto& entry       = found_[file.native()];
+	if(cached != cached_.end() && cached->second.time == stamp)
+	{
+		entry = cached->second;
+		return entry.unit;
+	}
+
+	entry    = {stamp, Scan(file)};
+	changed_ = true;
+	return entry.unit;
+}
+
+void Modules::Save()
+{
+	// The files, removed from the project, are dropped from the cache
+	if(!changed_ && found_.size() == cached_.size())
+	{
+		return;
+	}
+
+	std::string buffer{};
+	Write(buffer, constants::kMagic);
+	Write(buffer, constants::kVersion);
+	Write(buffer, static_cast<std::uint32_t>(found_.size()));
+	for(const auto& [file, entry] : found_)
+	{
+		Write(buffer, std::string_view{file});
+		Write(buffer, entry.time);
+		Write(buffer, std::string_view{entry.unit.provides});
+		Write(buffer, static_cast<std::uint8_t>(entry.unit.module));
+		Write(buffer, entry.unit.imports);
+	}
+
+	std::error_code error{};
+	if(const auto directory = cache_.parent_path(); !directory.empty())
+	{
+		std::filesystem::create_directories(directory, error);
+		if(error)
+		{
+			return;
+		}
+	}
+
+	// Write to a temporary file first, so a partially written cache is never loaded
+	auto temporary = cache_;
+	temporary += ".tmp";
+	{
+		std::ofstream stream{temporary, std::ios::binary | std::ios::trunc};
+		stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+		if(!stream)
+		{
+			std::filesystem::remove(temporary, error);
+			return;
+		}
+	}
+
+	std::filesystem::rename(temporary, cache_, error);
+	cached_  = found_;
+	changed_ = false;
+}
+
+Modules::Unit Modules::Scan(const std::filesystem::path& file)
+{
+	std::ifstream stream{file};
+	return Parse(std::string{std::istreambuf_iterator<char>{stream}, {}});
+}
+
+Modules::Unit Modules::Parse(std::string_view source)
+{
+	Unit unit{};
+
+	// The partitions are imported by their names in the module
+	std::string module{};
+	bool comment{false};
+	while(!source.empty())
+	{
+		const auto end  = source.find('\n');
+		const auto line = Strip(source.substr(0, end), comment);
+		source.remove_prefix(end == std::string_view::npos ? source.size() : end + 1);
+
+		std::string_view statement{line};
+		statement.remove_prefix(std::min(statement.find_first_not_of(" \t"), statement.size()));
+		const auto exported = Consume(statement, constants::kExport);
+		if(Consume(statement, constants::kModule))
+		{
+			// Neither the global nor the private module fragments name a module
+			auto name = GetName(statement);
+			if(name.empty() || name.front() == ':')
+			{
+				continue;
+			}
+
+			// The implementation unit imports the interface of it's module, the partitions provide their own
+			unit.module = true;
+			module      = name.substr(0, name.find(':'));
+			if(exported || name != module)
+			{
+				unit.provides = std::move(name);
+			}
+			else
+			{
+				unit.imports.push_back(std::move(name));
+			}
+		}
+		else if(Consume(statement, constants::kImport))
+		{
+			// The header units are not supported, their names are not valid
+			auto name = GetName(statement);
+			if(!name.empty())
+			{
+				unit.imports.push_back(name.front() == ':' ? module + name : std::move(name));
+			}
+		}
+	}
+
+	return unit;
+}
+
+void Modules::Load()
+{
+	std::ifstream stream{cache_, std::ios::binary};
+	const std::string data{std::istreambuf_iterator<char>{stream}, {}};
+	Reader reader{data};
+	if(reader.Read<std::uint32_t>() != constants::kMagic || reader.Read<std::uint32_t>() != constants::kVersion)
+	{
+		return;
+	}
+
+	for(auto count = reader.Read<std::uint32_t>(); count && reader.IsValid(); --count)
+	{
+		auto file = std::string{reader.ReadString()};
+		Entry entry{};
+		entry.time          = reader.Read<std::int64_t>();
+		entry.unit.provides = std::string{reader.ReadString()};
+		entry.unit.module   = reader.Read<std::uint8_t>() != 0;
+		entry.unit.imports  = reader.ReadStrings();
+		cached_.emplace(std::move(file), std::move(entry));
+	}
+
+	// A truncated cache is treated as a missing one
+	if(!reader.IsValid())
+	{
+		cached_.clear();
+	}
+}
+
+std::string Modules::Strip(std::string_view line, bool& comment)
+{
+	std::string code{};
+	for(std::size_t index = 0; index < line.size(); ++index)
+	{
+		if(comment)
+		{
+			if(line.compare(index, 2, "*/") == 0)
+			{
+				comment = false;
+				++index;
+			}
+		}
+		else if(line.compare(index, 2, "//") == 0)
+		{
+			break;
+		}
+		else if(line.compare(index, 2, "/*") == 0)
+		{
+			comment = true;
+			++index;
+		}
+		else if(line[index] == '"' || line[index] == '\'')
+		{
+			// The literals are kept as their quotes, so a comment inside of them is not mistaken for a real one
+			const auto quote = line[index];
+			code.push_back(quote);
+			while(++index < line.size() && line[index] != quote)
+			{
+				index += line[index] == '\\';
+			}
+			code.push_back(quote);
+		}
+		else
+		{
+			code.push_back(line[index]);
+		}
+	}
+
+	return code;
+}
+
+bool Modules::Consume(std::string_view& statement, std::string_view word)
+{
+	if(statement.compare(0, word.size(), word) != 0 ||
+	   (statement.size() > word.size() && IsIdentifier(statement[word.size()])))
+	{
+		return false;
+	}
+
+	statement.remove_prefix(word.size());
+	statement.remove_prefix(std::min(statement.find_first_not_of(" \t"), statement.size()));
+	return true;
+}
+
+std::string Modules::GetName(std::string_view statement)
+{
+	const auto end = statement.find(';');
+	if(end == std::string_view::npos)
+	{
+		return {};
+	}
+
+	// The names consist of the identifiers, separated by dots, and might name a partition
+	std::string name{};
+	for(const auto character : statement.substr(0, end))
+	{
+		if(character == ' ' || character == '\t')
+		{
+			continue;
+		}
+
+		if(!IsIdentifier(character) && character != '.' && character != ':')
+		{
+			return {};
+		}
+
+		name.push_back(character);
+	}
+
+	return name;
+}
+} // namespace scheduler::pipeline
\ No newline at end of file
@@ -19,6 +19,17 @@
 
 #include "scheduler/pipeline/pipeline.hpp"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <sstream>
+
 // clang-format off
 #ifdef __linux__
     #include "sys/nix/command.hpp"
@@ -29,90 +40,639 @@
 
 #include "sys/tools/compilers/gnuplusplus.hpp" // FIXME: Will be hardcoded untill !cmplr keyword is introduced
 #include "exceptions/filenotfoundexception.hpp"
+#include "scheduler/pathtable.hpp"
+#include "scheduler/exceptions/importcycleexception.hpp"
 #include "scheduler/exceptions/linkerrorexception.hpp"
 #include "scheduler/exceptions/nofilesspecifiedexception.hpp"
 #include "scheduler/exceptions/postcompilationcommandexception.hpp"
 #include "scheduler/exceptions/precompilationcommandexception.hpp"
+#include "scheduler/pipeline/unity.hpp"
+#include "sys/exceptions/compilationerrorexception.hpp"
 #include "sys/tools/compilerfactory.hpp"
+#include "utils/binary.hpp"
+#include "utils/joboutput.hpp"
+#include "utils/logger.hpp"
 
 namespace scheduler::pipeline
 {
-Pipeline::Pipeline(Job job)
+namespace constants
+{
+/**
+ * @brief The name of the component in the log
+ * 
+ */
+constexpr std::string_view kComponentName = "pipeline";
+
+/**
+ * @brief The entry, logged when the build of a project starts
+ * 
+ */
+const utils::LogFormat kBuildStarted{"Building {} from {} files"};
+
+/**
+ * @brief The entry, logged when the project is built
+ * 
+ */
+const utils::LogFormat kBuildFinished{"Built {} in {} ms"};
+
+/**
+ * @brief The entry, logged when a file is compiled
+ * 
+ */
+const utils::LogFormat kCompiling{"Compiling {}"};
+
+/**
+ * @brief The entry, logged when a file is skipped as it's up to date
+ * 
+ */
+const utils::LogFormat kUpToDate{"Skipping {}, it's up to date"};
+
+/**
+ * @brief The entry, logged when a header is precompiled
+ * 
+ */
+const utils::LogFormat kPrecompiling{"Precompiling {}"};
+
+/**
+ * @brief The entry, logged when other headers are selected to be precompiled
+ * 
+ */
+const utils::LogFormat kHeadersSelected{"Selected the headers to precompile for {}, they're used by the next build"};
+
+/**
+ * @brief The entry, logged when the files are grouped into the unity files
+ * 
+ */
+const utils::LogFormat kGrouped{"Grouped the files of {} into {} files to compile"};
+
+/**
+ * @brief The directory the stamps of the commands are kept in
+ * 
+ */
+constexpr std::string_view kStampsDirectory = ".bbs-cache/commands";
+
+/**
+ * @brief The directory in the project's output, where the precompiled headers are kept
+ * 
+ */
+constexpr std::string_view kPrecompiledHeadersDirectory = "pch";
+
+/**
+ * @brief The value of !pch, that makes the headers to precompile to be selected automatically
+ * 
+ */
+constexpr std::string_view kAutomaticPrecompiledHeader = "*";
+
+/**
+ * @brief The directory in the project's output, where the unity files are kept
+ * 
+ */
+constexpr std::string_view kUnityDirectory = "unity";
+
+/**
+ * @brief The directory in the project's output, where the compiled interfaces of the modules are kept
+ * 
+ */
+constexpr std::string_view kModulesDirectory = "modules";
+
+/**
+ * @brief The file in the modules' directory, that maps the modules to their interfaces
+ * 
+ */
+constexpr std::string_view kModuleMapper = "mapper";
+
+/**
+ * @brief The file in the modules' directory, where the modules of the project's files are cached
+ * 
+ */
+constexpr std::string_view kModulesCache = "units";
+
+/**
+ * @brief The extension of the compiled interfaces of the modules
+ * 
+ */
+constexpr std::string_view kInterfaceExtension = ".gcm";
+
+/**
+ * @brief The extensions of the generated files, which are compiled along with the project's files
+ * 
+ */
+constexpr std::array<std::string_view, 3> kSourceExtensions{".cpp", ".cc", ".cxx"};
+
+/**
+ * @brief The extensions of the generated files, which might be included by any of the project's files
+ * 
+ */
+constexpr std::array<std::string_view, 9> kHeaderExtensions{"", ".h", ".hh", ".hpp", ".hxx", ".inc", ".inl", ".ipp", ".tcc"};
+} // namespace constants
+
+namespace
+{
+/**
+ * @brief Check if the file has one of the extensions
+ * 
+ * @param file - the file to check
+ * @param extensions - the extensions to look for
+ * @return true if the extension of the file is in the list, false otherwise
+ */
+template<std::size_t N>
+bool HasExtension(const std::filesystem::path& file, const std::array<std::string_view, N>& extensions)
+{
+	const auto extension = file.extension().native();
+	return std::find(extensions.begin(), extensions.end(), extension) != extensions.end();
+}
+
+/**
+ * @brief Check if any of the files is in the other list
+ * 
+ * @param files - the files to look for
+ * @param others - the files to look in
+ * @return true if the lists share a file, false otherwise
+ */
+bool Intersects(const std::vector<std::filesystem::path>& files, const std::vector<std::filesystem::path>& others)
+{
+	return std::find_first_of(files.begin(), files.end(), others.begin(), others.end()) != files.end();
+}
+
+/**
+ * @brief Format the hash as a fixed-width hexadecimal name
+ * 
+ * @param hash - the hash to format
+ * @return std::string - the name
+ */
+std::string ToHex(std::uint64_t hash)
+{
+	std::stringstream name{};
+	name << std::hex << std::setw(16) << std::setfill('0') << hash;
+	return name.str();
+}
+} // namespace
+
+Pipeline::Pipeline(Job job, bool unity)
 	: job_{std::move(job)}
+	, unity_{unity}
+	, logger_{utils::Logger::GetInstance(constants::kComponentName)}
 {
 	using namespace sys::tools;
 	using namespace sys::tools::compilers;
 
-	compiler_ = std::move(CompilerFactory::Create(GNUPlusPlus::kCompiler,
-												  job_.GetCompilationFlags(),
-												  std::move(job_.GetIncludeDirectories())));
+	// Include directories are relative to the project, as the source files are
+	std::vector<std::filesystem::path> include_directories{};
+	for(const auto& directory : job_.GetIncludeDirectories())
+	{
+		include_directories.push_back(job_.GetProjectPath() / directory);
+	}
+
+	compiler_ = std::move(CompilerFactory::Create(
+		GNUPlusPlus::kCompiler, job_.GetCompilationFlags(), std::move(include_directories)));
+
+	// The headers are counted, only if they're selected automatically
+	if(job_.GetPrecompiledHeader() == constants::kAutomaticPrecompiledHeader)
+	{
+		includes_ = std::make_unique<Includes>(std::filesystem::path{job_.GetProjectName()} /
+											   constants::kPrecompiledHeadersDirectory);
+	}
 }
 
-void Pipeline::Run() const
+void Pipeline::Run(ThreadPool& pool) const
 {
-	ExecutePreprocessingCommands();
+	auto& paths = PathTable::GetInstance();
 
 	// Create the directory for the output
 	const std::filesystem::path folder{job_.GetProjectName()};
 	std::filesystem::create_directory(folder);
 
-	// Check if the project contains files
+	Graph graph{};
+	const auto& pre = job_.GetPreCompilationCommands();
+	const auto commands = AddCommands<exceptions::PreCompilationCommandException>(graph, pre);
+
+	// The files are compiled once the commands, that might have created the headers, are finished,
+	// and the write times, cached up to this point, are dropped
+	const auto headers = graph.Add([&paths] { paths.ResetWriteTimes(); });
+
+	// The header is precompiled before any of the files, and uses the headers created by the commands
+	auto compilation = headers;
+	std::filesystem::path precompiled{};
+	if(const auto header = GetPrecompiledHeader(); !header.empty())
+	{
+		const auto wrapper = GetWrapperPath(folder, header);
+		precompiled        = std::filesystem::path{wrapper}.concat(".gch");
+		compilation        = Precompile(graph, header, wrapper);
+		graph.AddDependency(compilation, headers);
+	}
+
+	// The sources, generated by the commands, are compiled as the project's files, once created
 	auto files = job_.GetFiles();
+	std::vector<std::optional<Graph::Id>> producers(files.size());
+	for(std::size_t index = 0; index < pre.size(); ++index)
+	{
+		const auto& outputs = pre[index].outputs;
+		if(pre[index].serial || outputs.empty() ||
+		   std::any_of(outputs.begin(), outputs.end(),
+					   [](const auto& output) { return HasExtension(output, constants::kHeaderExtensions); }))
+		{
+			graph.AddDependency(headers, commands[index]);
+		}
+
+		for(const auto& output : outputs)
+		{
+			if(!HasExtension(output, constants::kSourceExtensions))
+			{
+				continue;
+			}
+
+			const auto file = std::find(files.begin(), files.end(), output);
+			if(file == files.end())
+			{
+				files.push_back(output);
+				producers.push_back(commands[index]);
+			}
+			else
+			{
+				producers[file - files.begin()] = commands[index];
+			}
+		}
+	}
+
+	// Check if the project contains files
 	if(files.empty())
 	{
 		throw exceptions::NoFilesSpecifiedException();
 	}
 
-	// Actually build the project
-	auto obj = Compile(folder, std::move(files));
-	Link(folder, std::move(obj));
+	// The modules of the generated files are not known, as they don't exist yet,
+	// and only the files, changed since the previous build, are scanned again
+	Modules modules{folder / constants::kModulesDirectory / constants::kModulesCache};
+	std::vector<Modules::Unit> units(files.size());
+	for(std::size_t index = 0; index < files.size(); ++index)
+	{
+		if(!producers[index])
+		{
+			units[index] = modules.Find(job_.GetProjectPath() / files[index]);
+		}
+	}
+
+	modules.Save();
+
+	if(unity_)
+	{
+		Group(files, producers, units, pool.GetSize());
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	logger_.Log(utils::Logger::LogLevel::kInfo, constants::kBuildStarted, job_.GetProjectName(), files.size());
+
+	// The executable is linked once every file is compiled
+	std::vector<std::filesystem::path> objects{};
+	objects.reserve(files.size());
+	const auto link = graph.Add([this, &folder, &objects, start] {
+		Link(folder, objects);
+
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+		logger_.Log(utils::Logger::LogLevel::kInfo, constants::kBuildFinished, job_.GetProjectName(),
+				   std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+	});
+
+	// The files are relative to the project, nothing can be included before the declaration of a module
+	std::vector<Graph::Id> nodes{};
+	for(std::size_t index = 0; index < files.size(); ++index)
+	{
+		const auto source = paths.Intern(job_.GetProjectPath() / files[index]);
+		objects.push_back(folder / paths.GetObjectName(source));
+
+		auto header     = units[index].module ? std::filesystem::path{} : precompiled;
+		const auto node = Compile(graph, source, objects.back(), std::move(header), units[index]);
+		graph.AddDependency(node, compilation);
+		if(producers[index])
+		{
+			graph.AddDependency(node, *producers[index]);
+		}
+
+		graph.AddDependency(link, node);
+		nodes.push_back(node);
+	}
+
+	AddModules(graph, nodes, units);
+
+	// The headers, counted while checking the files, are selected for the next build
+	if(includes_)
+	{
+		const auto select = graph.Add([this, count = files.size()] { SelectHeaders(count); });
+		graph.AddDependency(select, link);
+	}
+
+	const auto post = AddCommands<exceptions::PostCompilationCommandException>(
+		graph, job_.GetPostCompilationCommands());
+	for(const auto node : post)
+	{
+		graph.AddDependency(node, link);
+	}
 
-	ExecutePostprocessingCommands();
+	// Wait for the whole graph, rethrowing the first error
+	graph.Run(pool);
+	pool.Wait();
 }
 
-std::vector<std::filesystem::path> Pipeline::Compile(const std::filesystem::path& folder,
-													 std::vector<std::filesystem::path> files) const
+Graph::Id Pipeline::Compile(Graph& graph, PathTable::Id source, std::filesystem::path obj,
+							std::filesystem::path precompiled, Modules::Unit unit) const
 {
-	std::vector<std::filesystem::path> object_files{};
-	for(const auto& file : files)
+	return graph.Add([this, source, obj = std::move(obj), precompiled = std::move(precompiled),
+					  unit = std::move(unit)]() {
+		using LogLevel = utils::Logger::LogLevel;
+
+		// The file might be created by the commands, so it's only checked once they're finished
+		auto& paths = PathTable::GetInstance();
+		if(!std::filesystem::exists(paths.GetPath(source)))
+		{
+			throw ::exceptions::FileNotFoundException(paths.GetPath(source));
+		}
+
+		// The diagnostics are printed as a whole, once the file is compiled or has failed to
+		auto output         = utils::JobOutput::GetInstance(job_.GetProjectName());
+		const auto listener = [&output](std::string_view data) { output.Capture(data); };
+		// The interfaces of the imported modules are the inputs of the file, as the headers are,
+		// and the interface, the file provides, must be there for the files that import it
+		const auto newer    = [this, &obj](const auto& module) { return IsNewer(GetInterfacePath(module), obj); };
+		const auto imported = std::any_of(unit.imports.begin(), unit.imports.end(), newer);
+		const auto provided = unit.provides.empty() || std::filesystem::exists(GetInterfacePath(unit.provides));
+		if(IsCompiled(source, obj, listener, includes_.get()) && !IsNewer(precompiled, obj) && !imported && provided)
+		{
+			logger_.Log<LogLevel::kDebug>(constants::kUpToDate, paths.GetPath(source).native());
+			return;
+		}
+
+		logger_.Log<LogLevel::kDebug>(constants::kCompiling, paths.GetPath(source).native());
+		if(unit.module)
+		{
+			compiler_->CompileModule(paths.GetPath(source), obj, listener);
+		}
+		else
+		{
+			compiler_->Compile(paths.GetPath(source), obj, listener);
+		}
+	});
+}
+
+void Pipeline::AddModules(Graph& graph, const std::vector<Graph::Id>& nodes,
+						  const std::vector<Modules::Unit>& units) const
+{
+	// The project doesn't use the modules, if none of it's files are the units or import any
+	if(std::none_of(units.begin(), units.end(),
+					[](const auto& unit) { return unit.module || !unit.imports.empty(); }))
 	{
-		// Check if the specified file exists
-		if(!std::filesystem::exists(file))
+		return;
+	}
+
+	std::map<std::string, std::size_t> providers{};
+	for(std::size_t index = 0; index < units.size(); ++index)
+	{
+		if(!units[index].provides.empty())
 		{
-			throw ::exceptions::FileNotFoundException(file);
+			providers.emplace(units[index].provides, index);
 		}
+	}
+
+	// The modules, that import each other, never get compiled, the graph is searched for such a cycle first,
+	// the modules from outside of the project are left for the compiler to find
+	enum class State
+	{
+		kNew,
+		kVisiting,
+		kVisited
+	};
+	std::vector<State> states(units.size(), State::kNew);
+	const std::function<void(std::size_t)> visit = [&](std::size_t index) {
+		states[index] = State::kVisiting;
+		for(const auto& module : units[index].imports)
+		{
+			const auto provider = providers.find(module);
+			if(provider == providers.end() || states[provider->second] == State::kVisited)
+			{
+				continue;
+			}
 
-		// Add the object file name to the list of parameters
-		const auto obj = folder / file.filename().replace_extension(".o");
-		object_files.push_back(std::move(obj.string()));
+			if(states[provider->second] == State::kVisiting)
+			{
+				throw exceptions::ImportCycleException(module);
+			}
 
-		// If the file was already built, skip the building process
-		if(IsCompiled(file, folder))
+			visit(provider->second);
+		}
+		states[index] = State::kVisited;
+	};
+
+	for(std::size_t index = 0; index < units.size(); ++index)
+	{
+		if(states[index] == State::kNew)
 		{
-			continue;
+			visit(index);
 		}
 
-		compiler_->Compile(job_.GetProjectPath() / file, obj);
+		for(const auto& module : units[index].imports)
+		{
+			if(const auto provider = providers.find(module); provider != providers.end())
+			{
+				graph.AddDependency(nodes[index], nodes[provider->second]);
+			}
+		}
 	}
 
-	return object_files;
+	// The mapper is only rewritten if the modules are changed
+	std::string content{};
+	for(const auto& [module, index] : providers)
+	{
+		content.append(module).append(1, ' ').append(GetInterfacePath(module).string()).append(1, '\n');
+	}
+
+	const auto mapper =
+		std::filesystem::absolute(job_.GetProjectName()) / constants::kModulesDirectory / constants::kModuleMapper;
+	std::ifstream stream{mapper};
+	if(std::string{std::istreambuf_iterator<char>{stream}, {}} != content)
+	{
+		std::filesystem::create_directories(mapper.parent_path());
+		std::ofstream{mapper, std::ios::trunc} << content;
+	}
+
+	compiler_->SetModuleMapper(mapper);
+}
+
+std::filesystem::path Pipeline::GetInterfacePath(const std::string& module) const
+{
+	// The partitions are named after their modules, the colon is replaced, as it's not a part of the names
+	auto name = module;
+	std::replace(name.begin(), name.end(), ':', '-');
+
+	return std::filesystem::absolute(job_.GetProjectName()) / constants::kModulesDirectory /
+		   (name + std::string{constants::kInterfaceExtension});
 }
 
-bool Pipeline::IsCompiled(const std::filesystem::path& file,
-						  const std::filesystem::path& folder) const
+void Pipeline::Group(std::vector<std::filesystem::path>& files, std::vector<std::optional<Graph::Id>>& producers,
+					 std::vector<Modules::Unit>& units, std::size_t workers) const
 {
+	std::vector<std::filesystem::path> isolated{};
+	for(const auto& file : job_.GetIsolatedFiles())
+	{
+		isolated.push_back((job_.GetProjectPath() / file).lexically_normal());
+	}
+
+	// The generated files might not exist yet, the isolated ones don't compile along with the others,
+	// and the imports and the declarations of the modules must precede the rest of the code
+	std::vector<std::filesystem::path> grouped{};
+	std::vector<std::filesystem::path> separate{};
+	std::vector<std::optional<Graph::Id>> separate_producers{};
+	std::vector<Modules::Unit> separate_units{};
+	for(std::size_t index = 0; index < files.size(); ++index)
+	{
+		const auto path = (job_.GetProjectPath() / files[index]).lexically_normal();
+		if(producers[index] || !std::filesystem::exists(path) ||
+		   std::find(isolated.begin(), isolated.end(), path) != isolated.end() || units[index].module ||
+		   !units[index].imports.empty())
+		{
+			separate.push_back(files[index]);
+			separate_producers.push_back(producers[index]);
+			separate_units.push_back(std::move(units[index]));
+		}
+		else
+		{
+			grouped.push_back(std::filesystem::absolute(path));
+		}
+	}
+
+	// The unity files are absolute, so they stay the same once joined with the project's path
+	const Unity unity{std::filesystem::absolute(job_.GetProjectName()) / constants::kUnityDirectory,
+					  std::filesystem::absolute(job_.GetProjectPath()).lexically_normal()};
+	files     = unity.Group(std::move(grouped), workers);
+	producers = std::vector<std::optional<Graph::Id>>(files.size());
+	units     = std::vector<Modules::Unit>(files.size());
+	files.insert(files.end(), separate.begin(), separate.end());
+	producers.insert(producers.end(), separate_producers.begin(), separate_producers.end());
+	units.insert(units.end(), separate_units.begin(), separate_units.end());
+
+	logger_.Log<utils::Logger::LogLevel::kDebug>(constants::kGrouped, job_.GetProjectName(), files.size());
+}
+
+Graph::Id Pipeline::Precompile(Graph& graph, std::filesystem::path header, std::filesystem::path wrapper) const
+{
+	return graph.Add([this, header = std::move(header), wrapper = std::move(wrapper)]() {
+		using LogLevel = utils::Logger::LogLevel;
+
+		if(!std::filesystem::exists(header))
+		{
+			throw ::exceptions::FileNotFoundException(header);
+		}
+
+		// The files include the wrapper of the header, so GCC finds the precompiled header next to it,
+		// the wrapper is only rewritten if it's changed, keeping the object files valid
+		const auto line = "#include \"" + std::filesystem::absolute(header).lexically_normal().string() + "\"\n";
+		std::ifstream stream{wrapper};
+		if(std::string{std::istreambuf_iterator<char>{stream}, {}} != line)
+		{
+			std::filesystem::create_directories(wrapper.parent_path());
+			std::ofstream{wrapper, std::ios::trunc} << line;
+		}
+
+		// The precompiled header is only rebuilt, when the header or it's dependencies change
+		auto& paths         = PathTable::GetInstance();
+		auto output         = utils::JobOutput::GetInstance(job_.GetProjectName());
+		const auto listener = [&output](std::string_view data) { output.Capture(data); };
+		const auto precompiled = std::filesystem::path{wrapper}.concat(".gch");
+		if(IsCompiled(paths.Intern(wrapper), precompiled, listener, nullptr))
+		{
+			logger_.Log<LogLevel::kDebug>(constants::kUpToDate, header.native());
+		}
+		else
+		{
+			logger_.Log<LogLevel::kDebug>(constants::kPrecompiling, header.native());
+			compiler_->Precompile(wrapper, precompiled, listener);
+		}
+
+		// The files, compiled after this node, use the precompiled header
+		compiler_->SetPrecompiledHeader(wrapper);
+	});
+}
+
+std::filesystem::path Pipeline::GetPrecompiledHeader() const
+{
+	// The selected headers are only known once a previous build has counted them
+	if(includes_)
+	{
+		return std::filesystem::exists(includes_->GetHeader()) ? includes_->GetHeader() : std::filesystem::path{};
+	}
+
+	const auto& header = job_.GetPrecompiledHeader();
+	return header.empty() ? header : job_.GetProjectPath() / header;
+}
+
+std::filesystem::path Pipeline::GetWrapperPath(const std::filesystem::path& folder,
+											   const std::filesystem::path& header) const
+{
+	// The header is precompiled once per set of flags, as GCC rejects the ones built with other flags
+	std::string flags{job_.GetCompilationFlags()};
+	for(const auto& directory : job_.GetIncludeDirectories())
+	{
+		flags.append(1, '\0').append(directory.native());
+	}
+
+	return folder / constants::kPrecompiledHeadersDirectory / ToHex(utils::binary::Hash(flags)) / header.filename();
+}
+
+void Pipeline::SelectHeaders(std::size_t files) const
+{
+	// A header, that can't be preprocessed alone, is never selected, the diagnostics are dropped
+	const auto listener = [](std::string_view) {};
+	const auto weigh    = [this, &listener](const std::filesystem::path& header) -> std::size_t {
+		try
+		{
+			return compiler_->Preprocess(header, listener).size();
+		}
+		catch(const sys::exceptions::CompilationErrorException&)
+		{
+			return 0;
+		}
+	};
+
+	if(includes_->Update(files, weigh))
+	{
+		logger_.Log(utils::Logger::LogLevel::kInfo, constants::kHeadersSelected, job_.GetProjectName());
+	}
+}
+
+bool Pipeline::IsNewer(const std::filesystem::path& file, const std::filesystem::path& obj)
+{
+	if(file.empty())
+	{
+		return false;
+	}
+
+	// A missing file is never newer
+	std::error_code error{};
+	const auto time = std::filesystem::last_write_time(file, error);
+	return !error && time > std::filesystem::last_write_time(obj, error);
+}
+
+bool Pipeline::IsCompiled(PathTable::Id file, const std::filesystem::path& obj,
+						  const sys::Command::Listener& listener, Includes* includes) const
+{
+	auto& paths = PathTable::GetInstance();
+
 	// Check if the object file is built or created after the file was updated
-	const auto obj = folder / file.filename().replace_extension(".o");
-	if(!std::filesystem::exists(obj) ||
-	   std::filesystem::last_write_time(file) > std::filesystem::last_write_time(obj))
+	std::error_code error{};
+	const auto time = std::filesystem::last_write_time(obj, error);
+	if(error || paths.GetWriteTime(file) > time)
 	{
 		return false;
 	}
 
-	const auto dependencies = compiler_->GetDependencies(file);
+	// The headers are shared by many files, their times are only read once
+	const auto dependencies = compiler_->GetDependencies(paths.GetPath(file), listener);
+	if(includes)
+	{
+		includes->Add(dependencies);
+	}
+
 	for(const auto& dependency : dependencies)
 	{
-		if(std::filesystem::last_write_time(obj) < std::filesystem::last_write_time(dependency))
+		if(time < paths.GetWriteTime(paths.Intern(dependency)))
 		{
 			return false;
 		}
@@ -124,46 +684,152 @@ bool Pipeline::IsCompiled(const std::filesystem::path& file,
 void Pipeline::Link(const std::filesystem::path& folder,
 					std::vector<std::filesystem::path> files) const
 {
-	std::stringstream parameters{};
-	for(const auto& file : files)
+	// Link all the object files into the executable
+	auto output         = utils::JobOutput::GetInstance(job_.GetProjectName());
+	const auto listener = [&output](std::string_view data) { output.Capture(data); };
+	if(!compiler_->Link(files, folder / job_.GetProjectName(), listener))
 	{
-		parameters << file.string() << " ";
+		throw exceptions::LinkErrorException(job_.GetProjectName());
 	}
+}
 
-	// Set the name of the executable
-	parameters << "-o" << (folder / job_.GetProjectName()).string();
+bool Pipeline::Execute(const Job::Command& command) const
+{
+	if(IsUpToDate(command))
+	{
+		logger_.Log<utils::Logger::LogLevel::kDebug>(constants::kUpToDate, command.line);
+		return true;
+	}
 
-	// Link all the object files into the executable
-	Command command{sys::tools::compilers::GNUPlusPlus::kCompiler, parameters.str()};
-	if(!command.Execute())
+	// The outputs are not trusted, until the command succeeds again
+	std::error_code error{};
+	const auto stamp = GetStampPath(command);
+	if(!command.outputs.empty())
 	{
-		throw exceptions::LinkErrorException(job_.GetProjectName());
+		std::filesystem::remove(stamp, error);
 	}
+
+	// The inputs and the outputs are relative to the project, so the command runs in it's directory
+	auto output = utils::JobOutput::GetInstance(job_.GetProjectName());
+	Command process{command.line};
+	process.SetDirectory(job_.GetProjectPath());
+	process.SetListener([&output](std::string_view data) { output.Capture(data); });
+	const auto result = process.Execute();
+	output.Capture(process.GetOutput());
+	if(!result)
+	{
+		return false;
+	}
+
+	if(!command.outputs.empty())
+	{
+		std::filesystem::create_directories(stamp.parent_path(), error);
+
+		const auto hash = Hash(command);
+		std::ofstream stream{stamp, std::ios::binary | std::ios::trunc};
+		stream.write(reinterpret_cast<const char*>(&hash), sizeof(hash));
+	}
+
+	return true;
 }
 
-void Pipeline::ExecutePreprocessingCommands() const
+bool Pipeline::IsUpToDate(const Job::Command& command) const
 {
-	// Execute pre-compilation commands
-	for(const auto& line : job_.GetPreCompilationCommands())
+	// Nothing is known about the command without the outputs, so it's always run
+	if(command.outputs.empty())
+	{
+		return false;
+	}
+
+	// The outputs must be created by the same command
+	std::uint64_t hash{};
+	std::ifstream stamp{GetStampPath(command), std::ios::binary};
+	if(!stamp.read(reinterpret_cast<char*>(&hash), sizeof(hash)) || hash != Hash(command))
+	{
+		return false;
+	}
+
+	// Every output must exist and be newer than every input
+	std::error_code error{};
+	auto oldest = std::filesystem::file_time_type::max();
+	for(const auto& output : command.outputs)
 	{
-		Command command{line};
-		if(command.Execute())
+		const auto time = std::filesystem::last_write_time(job_.GetProjectPath() / output, error);
+		if(error)
 		{
-			throw exceptions::PreCompilationCommandException(line);
+			return false;
 		}
+
+		oldest = std::min(oldest, time);
+	}
+
+	for(const auto& input : command.inputs)
+	{
+		const auto time = std::filesystem::last_write_time(job_.GetProjectPath() / input, error);
+		if(error || time > oldest)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+std::filesystem::path Pipeline::GetStampPath(const Job::Command& command) const
+{
+	std::string outputs{};
+	for(const auto& output : command.outputs)
+	{
+		const auto path = std::filesystem::absolute(job_.GetProjectPath() / output).lexically_normal();
+		outputs.append(path.native()).push_back('\0');
+	}
+
+	return std::filesystem::path{constants::kStampsDirectory} / ToHex(utils::binary::Hash(outputs));
+}
+
+std::uint64_t Pipeline::Hash(const Job::Command& command)
+{
+	std::string data{command.line};
+	for(const auto& input : command.inputs)
+	{
+		data.append(1, '\0').append(input.native());
 	}
+
+	return utils::binary::Hash(data);
 }
 
-void Pipeline::ExecutePostprocessingCommands() const
+template<typename Exception>
+std::vector<Graph::Id> Pipeline::AddCommands(Graph& graph, const std::vector<Job::Command>& commands) const
 {
-	// Execute post-compilation commands
-	for(const auto& line : job_.GetPostCompilationCommands())
+	std::vector<Graph::Id> nodes{};
+	nodes.reserve(commands.size());
+	for(std::size_t index = 0; index < commands.size(); ++index)
 	{
-		Command command{line};
-		if(command.Execute())
+		const auto& command = commands[index];
+		nodes.push_back(graph.Add([this, &command] {
+			if(!Execute(command))
+			{
+				throw Exception(command.line);
+			}
+		}));
+
+		// The rest of the commands are run concurrently
+		for(std::size_t previous = 0; previous < index; ++previous)
 		{
-			throw exceptions::PostCompilationCommandException(line);
+			if(command.serial || commands[previous].serial || IsDependent(command, commands[previous]))
+			{
+				graph.AddDependency(nodes[index], nodes[previous]);
+			}
 		}
 	}
+
+	return nodes;
+}
+
+bool Pipeline::IsDependent(const Job::Command& command, const Job::Command& previous)
+{
+	// The command either reads the files, created by the previous one, or overwrites it's files
+	return Intersects(command.inputs, previous.outputs) || Intersects(command.outputs, previous.outputs) ||
+		   Intersects(command.outputs, previous.inputs);
 }
 } // namespace scheduler::pipeline
\ No newline at end of file
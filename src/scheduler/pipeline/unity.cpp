@@ -0,0 +1,180 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "scheduler/pipeline/unity.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "utils/binary.hpp"
+
+namespace scheduler::pipeline
+{
+namespace constants
+{
+/**
+ * @brief The first line of the unity files
+ * 
+ */
+constexpr std::string_view kPreamble = "// Generated by bbs from the files of the project\n";
+
+/**
+ * @brief The extension of the unity files
+ * 
+ */
+constexpr std::string_view kExtension = ".cpp";
+
+/**
+ * @brief The smallest cost of a batch to aim for, in bytes of the sources
+ * 
+ */
+constexpr std::uintmax_t kMinimumCost = 64 * 1024;
+
+/**
+ * @brief The largest cost of a batch to aim for, in bytes of the sources
+ * 
+ */
+constexpr std::uintmax_t kMaximumCost = 1024 * 1024;
+
+/**
+ * @brief The range of the hashes, that decide if a file ends a batch
+ * 
+ */
+constexpr std::uint64_t kBoundaryScale = 1 << 16;
+} // namespace constants
+
+Unity::Unity(std::filesystem::path directory, std::filesystem::path root)
+	: directory_{std::move(directory)}
+	, root_{std::move(root)}
+{}
+
+std::vector<std::filesystem::path> Unity::Group(std::vector<std::filesystem::path> files, std::size_t workers) const
+{
+	// The order is fixed, so the batches only depend on the files themselves
+	std::sort(files.begin(), files.end());
+	files.erase(std::unique(files.begin(), files.end()), files.end());
+
+	// The files are weighed by their size, as it's known without compiling them
+	std::vector<std::uintmax_t> costs{};
+	std::uintmax_t total{0};
+	for(const auto& file : files)
+	{
+		std::error_code error{};
+		const auto size = std::filesystem::file_size(file, error);
+		costs.push_back(error ? 1 : std::max<std::uintmax_t>(size, 1));
+		total += costs.back();
+	}
+
+	// Every worker gets a batch, the target is rounded down to a power of two, so small edits don't change it
+	const auto share = total / std::max<std::size_t>(workers, 1);
+	auto target      = constants::kMinimumCost;
+	while(target * 2 <= std::min(share, constants::kMaximumCost))
+	{
+		target *= 2;
+	}
+
+	auto starts = Split(files, costs, target);
+	starts.push_back(files.size());
+
+	std::vector<std::filesystem::path> result{};
+	for(std::size_t batch = 0; batch + 1 < starts.size(); ++batch)
+	{
+		result.push_back(Write(files.begin() + starts[batch], files.begin() + starts[batch + 1]));
+	}
+
+	// The unity files of the batches, that are gone, are removed
+	std::error_code error{};
+	const std::set<std::filesystem::path> used{result.begin(), result.end()};
+	for(const auto& entry : std::filesystem::directory_iterator{directory_, error})
+	{
+		if(entry.path().extension() == constants::kExtension && !used.count(entry.path()))
+		{
+			std::filesystem::remove(entry.path(), error);
+		}
+	}
+
+	return result;
+}
+
+std::vector<std::size_t> Unity::Split(const std::vector<std::filesystem::path>& files,
+									  const std::vector<std::uintmax_t>& costs, std::uintmax_t target) const
+{
+	std::vector<std::size_t> starts{};
+	bool boundary{true};
+	for(std::size_t index = 0; index < files.size(); ++index)
+	{
+		if(boundary)
+		{
+			starts.push_back(index);
+		}
+
+		// Whether a file ends a batch only depends on it's name and size, so an added or removed file
+		// only changes it's own batch, and the chance to end a batch grows with the size of the file,
+		// so the batches cost about the target on average
+		const auto hash = GetHash(files[index]) % constants::kBoundaryScale;
+		boundary        = hash * target < costs[index] * constants::kBoundaryScale;
+	}
+
+	return starts;
+}
+
+std::filesystem::path Unity::Write(std::vector<std::filesystem::path>::const_iterator begin,
+								   std::vector<std::filesystem::path>::const_iterator end) const
+{
+	// A single file is compiled as it is
+	if(std::next(begin) == end)
+	{
+		return *begin;
+	}
+
+	std::string content{constants::kPreamble};
+	for(auto file = begin; file != end; ++file)
+	{
+		content.append("#include \"").append(file->string()).append("\"\n");
+	}
+
+	// The batch is named after it's first file, so it keeps the name while the rest of it changes
+	std::stringstream name{};
+	name << std::hex << std::setw(16) << std::setfill('0') << GetHash(*begin)
+		 << constants::kExtension;
+	const auto path = directory_ / name.str();
+
+	// The unity file is only rewritten if the batch is changed, as it makes the batch to be compiled again
+	std::ifstream stream{path};
+	if(std::string{std::istreambuf_iterator<char>{stream}, {}} != content)
+	{
+		std::error_code error{};
+		std::filesystem::create_directories(directory_, error);
+		std::ofstream{path, std::ios::trunc} << content;
+	}
+
+	return path;
+}
+std::uint64_t Unity::GetHash(const std::filesystem::path& file) const
+{
+	// The files are hashed by their paths in the project, so the batches don't depend on where it's checked out
+	return utils::binary::Hash(file.lexically_relative(root_).generic_string());
+}
+} // namespace scheduler::pipeline
\ No newline at end of file
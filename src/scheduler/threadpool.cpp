@@ -0,0 +1,128 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "scheduler/threadpool.hpp"
+
+#include <algorithm>
+
+namespace scheduler
+{
+ThreadPool::ThreadPool(std::size_t size)
+{
+	size = std::max<std::size_t>(size, 1);
+	workers_.reserve(size);
+	for(std::size_t i = 0; i < size; ++i)
+	{
+		workers_.emplace_back(&ThreadPool::Work, this);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::unique_lock<std::mutex> lock{mutex_};
+		stopping_ = true;
+	}
+	available_.notify_all();
+
+	for(auto& worker : workers_)
+	{
+		worker.join();
+	}
+}
+
+void ThreadPool::Submit(std::function<void()> task)
+{
+	{
+		std::unique_lock<std::mutex> lock{mutex_};
+		tasks_.push(std::move(task));
+		++pending_;
+	}
+	available_.notify_one();
+}
+
+void ThreadPool::Wait()
+{
+	std::unique_lock<std::mutex> lock{mutex_};
+	finished_.wait(lock, [this] { return pending_ == 0; });
+
+	// Rethrow the first error, making the pool usable again
+	if(exception_)
+	{
+		auto exception = std::move(exception_);
+		exception_ = nullptr;
+		std::rethrow_exception(exception);
+	}
+}
+
+std::size_t ThreadPool::GetSize() const
+{
+	return workers_.size();
+}
+
+void ThreadPool::Work()
+{
+	while(true)
+	{
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock{mutex_};
+			available_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+			if(tasks_.empty())
+			{
+				return;
+			}
+
+			task = std::move(tasks_.front());
+			tasks_.pop();
+
+			// Don't start anything new after a failure
+			if(exception_)
+			{
+				if(--pending_ == 0)
+				{
+					finished_.notify_all();
+				}
+				continue;
+			}
+		}
+
+		std::exception_ptr exception;
+		try
+		{
+			task();
+		}
+		catch(...)
+		{
+			exception = std::current_exception();
+		}
+
+		std::unique_lock<std::mutex> lock{mutex_};
+		if(exception && !exception_)
+		{
+			exception_ = std::move(exception);
+		}
+
+		if(--pending_ == 0)
+		{
+			finished_.notify_all();
+		}
+	}
+}
+} // namespace scheduler
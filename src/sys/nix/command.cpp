@@ -19,12 +19,60 @@
 
 #include "sys/nix/command.hpp"
 
+#include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 #include <array>
-#include <cstdio>
-#include <cstdlib>
+#include <cerrno>
+#include <functional>
+
+extern char** environ;
 
 namespace sys::nix
 {
+namespace
+{
+/**
+ * @brief Convert the given time value to microseconds
+ * 
+ * @param value - the value to convert
+ * @return std::chrono::microseconds - the converted value
+ */
+std::chrono::microseconds ToMicroseconds(const timeval& value)
+{
+	return std::chrono::seconds{value.tv_sec} + std::chrono::microseconds{value.tv_usec};
+}
+
+/**
+ * @brief Read the data, available in the descriptor, passing it to the consumer
+ * 
+ * @param descriptor - the descriptor to read
+ * @param consumer - the function to pass the data to
+ * @return true if the descriptor might have more data, false if it's closed or failed
+ */
+bool Read(int descriptor, const Command::Listener& consumer)
+{
+	std::array<char, 4096> buffer;
+	ssize_t count;
+	do
+	{
+		count = read(descriptor, buffer.data(), buffer.size());
+	} while(count < 0 && errno == EINTR);
+
+	if(count <= 0)
+	{
+		return false;
+	}
+
+	consumer({buffer.data(), static_cast<std::size_t>(count)});
+	return true;
+}
+} // namespace
+
 Command::Command(std::string line)
 	: command_{line}
 {}
@@ -35,23 +83,131 @@ Command::Command(std::string program, std::string parameters)
 
 bool Command::Execute()
 {
-	auto pipe = popen(command_.c_str(), "r");
-	if(!pipe)
+	// Create the pipes to read the output and the errors, they must not leak into other commands
+	int output[2];
+	int errors[2]{-1, -1};
+	if(pipe2(output, O_CLOEXEC) != 0)
+	{
+		return false;
+	}
+
+	if(listener_ && pipe2(errors, O_CLOEXEC) != 0)
+	{
+		close(output[0]);
+		close(output[1]);
+		return false;
+	}
+
+	// Redirect the standard output of the child into the pipe, and the errors, if they are listened to
+	posix_spawn_file_actions_t actions;
+	posix_spawn_file_actions_init(&actions);
+	posix_spawn_file_actions_adddup2(&actions, output[1], STDOUT_FILENO);
+	if(listener_)
+	{
+		posix_spawn_file_actions_adddup2(&actions, errors[1], STDERR_FILENO);
+	}
+
+	if(!directory_.empty())
+	{
+		posix_spawn_file_actions_addchdir_np(&actions, directory_.c_str());
+	}
+
+	// Run the command through the shell, as popen() does
+	pid_t pid;
+	const char* arguments[] = {"sh", "-c", command_.c_str(), nullptr};
+	const auto status = posix_spawn(
+		&pid, "/bin/sh", &actions, nullptr, const_cast<char* const*>(arguments), environ);
+	posix_spawn_file_actions_destroy(&actions);
+	close(output[1]);
+	if(listener_)
+	{
+		close(errors[1]);
+	}
+
+	// Read both of the pipes as the data arrives, until the child closes them,
+	// the descriptors, which are not used, are ignored by poll()
+	std::array<pollfd, 2> descriptors{{{output[0], POLLIN, 0}, {errors[0], POLLIN, 0}}};
+	const Listener append = [this](std::string_view data) { output_.append(data); };
+	const std::array<std::reference_wrapper<const Listener>, 2> consumers{append, listener_};
+	while(status == 0 && (descriptors[0].fd >= 0 || descriptors[1].fd >= 0))
+	{
+		if(poll(descriptors.data(), descriptors.size(), -1) < 0)
+		{
+			if(errno == EINTR)
+			{
+				continue;
+			}
+			break;
+		}
+
+		for(std::size_t index = 0; index < descriptors.size(); ++index)
+		{
+			auto& descriptor = descriptors[index];
+			if(descriptor.fd < 0 || !descriptor.revents)
+			{
+				continue;
+			}
+
+			if(!Read(descriptor.fd, consumers[index]))
+			{
+				close(descriptor.fd);
+				descriptor.fd = -1;
+			}
+		}
+	}
+
+	for(const auto& descriptor : descriptors)
+	{
+		if(descriptor.fd >= 0)
+		{
+			close(descriptor.fd);
+		}
+	}
+
+	if(status != 0)
 	{
 		return false;
 	}
 
-	std::array<char, 128> buffer;
-	while(fgets(buffer.data(), static_cast<int>(buffer.size()), pipe) != nullptr)
+	// Reap the child, collecting the resources it has consumed
+	int exit_status;
+	rusage resources{};
+	while(wait4(pid, &exit_status, 0, &resources) < 0)
 	{
-		output_ += buffer.data();
+		if(errno != EINTR)
+		{
+			return false;
+		}
 	}
 
-	return pclose(pipe) == 0;
+	usage_.user_time = ToMicroseconds(resources.ru_utime);
+	usage_.system_time = ToMicroseconds(resources.ru_stime);
+	usage_.max_resident_set_size = resources.ru_maxrss;
+	usage_.voluntary_context_switches = resources.ru_nvcsw;
+	usage_.involuntary_context_switches = resources.ru_nivcsw;
+	usage_.block_input_operations = resources.ru_inblock;
+	usage_.block_output_operations = resources.ru_oublock;
+
+	return WIFEXITED(exit_status) && WEXITSTATUS(exit_status) == 0;
 }
 
 std::string Command::GetOutput() const
 {
 	return output_;
 }
+
+void Command::SetListener(Listener listener)
+{
+	listener_ = std::move(listener);
+}
+
+void Command::SetDirectory(std::filesystem::path directory)
+{
+	directory_ = std::move(directory);
+}
+
+Usage Command::GetUsage() const
+{
+	return usage_;
+}
 } // namespace sys::nix
\ No newline at end of file
@@ -0,0 +1,80 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "sys/nix/mappedfile.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "exceptions/filenotfoundexception.hpp"
+
+namespace sys::nix
+{
+MappedFile::MappedFile(const std::filesystem::path& path)
+{
+	const auto descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if(descriptor < 0)
+	{
+		throw ::exceptions::FileNotFoundException(path);
+	}
+
+	// Only regular files can be mapped
+	struct stat status;
+	if(fstat(descriptor, &status) != 0 || !S_ISREG(status.st_mode))
+	{
+		close(descriptor);
+		throw ::exceptions::FileNotFoundException(path);
+	}
+
+	// Zero-length mappings are not allowed, an empty file is represented by an empty view
+	size_ = static_cast<std::size_t>(status.st_size);
+	if(size_ != 0)
+	{
+		data_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+		if(data_ == MAP_FAILED)
+		{
+			data_ = nullptr;
+			size_ = 0;
+			close(descriptor);
+			throw ::exceptions::FileNotFoundException(path);
+		}
+
+		// The file is read front to back exactly once
+		madvise(data_, size_, MADV_SEQUENTIAL);
+	}
+
+	// The mapping stays valid after the descriptor is closed
+	close(descriptor);
+}
+
+MappedFile::~MappedFile()
+{
+	if(data_)
+	{
+		munmap(data_, size_);
+	}
+}
+
+std::string_view MappedFile::GetData() const
+{
+	return {static_cast<const char*>(data_), size_};
+}
+} // namespace sys::nix
\ No newline at end of file
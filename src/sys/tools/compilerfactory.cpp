@@ -29,6 +29,13 @@ CompilerFactory::Create(const std::string& value,
 						std::string flags,
 						std::vector<std::filesystem::path> include_directories)
 {
+	const auto& registry = GetRegistry();
+	const auto iterator = registry.find(value);
+	if(iterator != registry.end())
+	{
+		return iterator->second(std::move(flags), std::move(include_directories));
+	}
+
 	if(value == compilers::GNUPlusPlus::kCompiler)
 	{
 		return std::unique_ptr<Compiler>{
@@ -37,4 +44,15 @@ CompilerFactory::Create(const std::string& value,
 
 	throw exceptions::UnsupportedCompilerException{value};
 }
+
+void CompilerFactory::Register(const std::string& value, Creator creator)
+{
+	GetRegistry()[value] = std::move(creator);
+}
+
+std::map<std::string, CompilerFactory::Creator>& CompilerFactory::GetRegistry()
+{
+	static std::map<std::string, Creator> registry{};
+	return registry;
+}
 } // namespace sys::tools
\ No newline at end of file
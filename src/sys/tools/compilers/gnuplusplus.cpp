@@ -44,7 +44,8 @@ GNUPlusPlus::GNUPlusPlus(std::string&& flags,
 	, kDirectories{std::move(include_directories)}
 {}
 
-void GNUPlusPlus::Compile(const std::filesystem::path& file, const std::filesystem::path& out)
+void GNUPlusPlus::Compile(const std::filesystem::path& file, const std::filesystem::path& out,
+						  const Command::Listener& listener)
 {
 	std::stringstream parameters;
 	parameters << kFlags << " -c " << file.string() << " -o " << out.string();
@@ -55,15 +56,85 @@ void GNUPlusPlus::Compile(const std::filesystem::path& file, const std::filesyst
 		parameters << " -I " << directory.string();
 	}
 
+	// GCC picks the precompiled header up, if it's next to the header and matches the flags
+	if(!header_.empty())
+	{
+		parameters << " -include " << header_.string() << " -Winvalid-pch";
+	}
+
+	// The imported modules are looked up in the mapper
+	if(!mapper_.empty())
+	{
+		parameters << " -fmodules-ts -fmodule-mapper=" << mapper_.string();
+	}
+
+	SystemCommand command{kCompiler, parameters.str()};
+	command.SetListener(listener);
+	if(!command.Execute())
+	{
+		throw exceptions::CompilationErrorException(file);
+	}
+}
+
+void GNUPlusPlus::CompileModule(const std::filesystem::path& file, const std::filesystem::path& out,
+								const Command::Listener& listener)
+{
+	std::stringstream parameters;
+	parameters << kFlags << " -c " << file.string() << " -o " << out.string();
+
+	// Add include directories
+	for(auto& directory : kDirectories)
+	{
+		parameters << " -I " << directory.string();
+	}
+
+	// GCC writes the interface of the module to the file, the mapper names for it
+	parameters << " -fmodules-ts";
+	if(!mapper_.empty())
+	{
+		parameters << " -fmodule-mapper=" << mapper_.string();
+	}
+
 	SystemCommand command{kCompiler, parameters.str()};
+	command.SetListener(listener);
 	if(!command.Execute())
 	{
 		throw exceptions::CompilationErrorException(file);
 	}
 }
 
+void GNUPlusPlus::Precompile(const std::filesystem::path& header, const std::filesystem::path& out,
+							 const Command::Listener& listener)
+{
+	std::stringstream parameters;
+	parameters << kFlags << " -x c++-header " << header.string() << " -o " << out.string();
+
+	// Add include directories
+	for(auto& directory : kDirectories)
+	{
+		parameters << " -I " << directory.string();
+	}
+
+	SystemCommand command{kCompiler, parameters.str()};
+	command.SetListener(listener);
+	if(!command.Execute())
+	{
+		throw exceptions::CompilationErrorException(header);
+	}
+}
+
+void GNUPlusPlus::SetPrecompiledHeader(const std::filesystem::path& header)
+{
+	header_ = header;
+}
+
+void GNUPlusPlus::SetModuleMapper(const std::filesystem::path& mapper)
+{
+	mapper_ = mapper;
+}
+
 std::vector<std::filesystem::path>
-GNUPlusPlus::GetDependencies(const std::filesystem::path& file) const
+GNUPlusPlus::GetDependencies(const std::filesystem::path& file, const Command::Listener& listener) const
 {
 	std::stringstream parameters;
 	parameters << kFlags << " -MM " << file.string();
@@ -75,6 +146,7 @@ GNUPlusPlus::GetDependencies(const std::filesystem::path& file) const
 	}
 
 	SystemCommand command{kCompiler, parameters.str()};
+	command.SetListener(listener);
 	if(!command.Execute())
 	{
 		throw exceptions::CompilationErrorException(file);
@@ -91,11 +163,55 @@ GNUPlusPlus::GetDependencies(const std::filesystem::path& file) const
 	std::vector<std::filesystem::path> dependencies;
 	for(auto it = strings.begin() + 2; it != strings.end(); ++it)
 	{
+		// Skip the line continuations of the long rules
+		if(*it == "\\")
+		{
+			continue;
+		}
+
 		dependencies.emplace_back(*it);
 	}
 	return dependencies;
 }
 
+std::string GNUPlusPlus::Preprocess(const std::filesystem::path& file, const Command::Listener& listener) const
+{
+	std::stringstream parameters;
+	parameters << kFlags << " -E -P " << file.string();
+
+	// Add include directories
+	for(auto& directory : kDirectories)
+	{
+		parameters << " -I " << directory.string();
+	}
+
+	SystemCommand command{kCompiler, parameters.str()};
+	command.SetListener(listener);
+	if(!command.Execute())
+	{
+		throw exceptions::CompilationErrorException(file);
+	}
+
+	return command.GetOutput();
+}
+
+bool GNUPlusPlus::Link(const std::vector<std::filesystem::path>& files,
+					   const std::filesystem::path& out, const Command::Listener& listener)
+{
+	std::stringstream parameters{};
+	for(const auto& file : files)
+	{
+		parameters << file.string() << " ";
+	}
+
+	// Set the name of the executable
+	parameters << "-o" << out.string();
+
+	SystemCommand command{kCompiler, parameters.str()};
+	command.SetListener(listener);
+	return command.Execute();
+}
+
 std::vector<std::string> GNUPlusPlus::Split(std::string string, const std::string& delimiter)
 {
 	std::vector<std::string> tokens;
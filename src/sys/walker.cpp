@@ -0,0 +1,385 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "sys/walker.hpp"
+
+#include <fnmatch.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <system_error>
+
+#include "exceptions/filenotfoundexception.hpp"
+#include "sys/mappedfile.hpp"
+#include "utils/binary.hpp"
+
+namespace sys
+{
+namespace constants
+{
+/**
+ * @brief The signature of the listings' cache, "BBSW" in the little-endian byte order
+ * 
+ */
+constexpr std::uint32_t kMagic = 0x57534242;
+
+/**
+ * @brief The version of the listings' cache layout
+ * 
+ */
+constexpr std::uint32_t kVersion = 1;
+
+/**
+ * @brief The pattern that matches any number of directories
+ * 
+ */
+constexpr std::string_view kRecursive = "**";
+
+/**
+ * @brief The characters that make a value a glob pattern
+ * 
+ */
+constexpr std::string_view kWildcards = "*?[";
+} // namespace constants
+
+using utils::binary::Reader;
+using utils::binary::Write;
+
+Walker::Walker(std::filesystem::path cache, std::size_t jobs)
+	: cache_{std::move(cache)}
+	, pool_{jobs}
+{
+	Load();
+}
+
+std::vector<std::filesystem::path> Walker::Glob(const std::filesystem::path& root, std::string_view pattern)
+{
+	const auto segments = Split(pattern);
+	if(segments.empty())
+	{
+		return {};
+	}
+
+	// The leading components without wildcards point to the only directory worth walking
+	std::filesystem::path base{};
+	auto first = segments.begin();
+	while(std::next(first) != segments.end() && !IsPattern(*first))
+	{
+		base /= *first++;
+	}
+
+	// Unless "**" is used, the pattern limits how deep the files might be
+	const bool recursive = std::find(first, segments.end(), constants::kRecursive) != segments.end();
+	const auto depth     = recursive ? std::numeric_limits<std::size_t>::max()
+									 : static_cast<std::size_t>(std::distance(first, segments.end())) - 1;
+
+	std::vector<std::filesystem::path> result{};
+	for(auto& file : Walk(base.empty() ? root : root / base, depth))
+	{
+		const auto value      = file.generic_string();
+		const auto components = Split(value);
+		if(Match(&*first, segments.data() + segments.size(), components.data(),
+				 components.data() + components.size()))
+		{
+			result.push_back(base / file);
+		}
+	}
+
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+void Walker::Save()
+{
+	std::string buffer{};
+	{
+		std::lock_guard lock{mutex_};
+		if(!changed_)
+		{
+			return;
+		}
+
+		Write(buffer, constants::kMagic);
+		Write(buffer, constants::kVersion);
+		Write(buffer, static_cast<std::uint32_t>(listings_.size()));
+		for(const auto& [directory, listing] : listings_)
+		{
+			Write(buffer, std::string_view{directory});
+			Write(buffer, listing->time);
+			Write(buffer, listing->files);
+			Write(buffer, listing->directories);
+		}
+
+		changed_ = false;
+	}
+
+	std::error_code error{};
+	if(const auto directory = cache_.parent_path(); !directory.empty())
+	{
+		std::filesystem::create_directories(directory, error);
+		if(error)
+		{
+			return;
+		}
+	}
+
+	// Write to a temporary file first, so a partially written cache is never loaded
+	auto temporary = cache_;
+	temporary += ".tmp";
+	{
+		std::ofstream stream{temporary, std::ios::binary | std::ios::trunc};
+		stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+		if(!stream)
+		{
+			std::filesystem::remove(temporary, error);
+			return;
+		}
+	}
+
+	std::filesystem::rename(temporary, cache_, error);
+}
+
+bool Walker::IsPattern(std::string_view value)
+{
+	return value.find_first_of(constants::kWildcards) != std::string_view::npos;
+}
+
+std::vector<std::filesystem::path> Walker::Walk(const std::filesystem::path& base, std::size_t depth)
+{
+	std::vector<std::filesystem::path> files{};
+	std::vector<std::filesystem::path> level{std::filesystem::path{}};
+	for(std::size_t current = 0; !level.empty(); ++current)
+	{
+		// The directories of a level are independent, so they are listed simultaneously,
+		// the pool is shared by the concurrent calls, so only the listings of this one are waited for
+		std::vector<std::shared_ptr<const Listing>> listings(level.size());
+		std::mutex mutex{};
+		std::condition_variable condition{};
+		std::size_t remaining{level.size()};
+		std::exception_ptr exception{};
+		for(std::size_t index = 0; index < level.size(); ++index)
+		{
+			pool_.Submit([&, index] {
+				std::exception_ptr error{};
+				try
+				{
+					listings[index] = GetListing(level[index].empty() ? base : base / level[index]);
+				}
+				catch(...)
+				{
+					error = std::current_exception();
+				}
+
+				std::lock_guard lock{mutex};
+				if(error && !exception)
+				{
+					exception = error;
+				}
+
+				if(--remaining == 0)
+				{
+					condition.notify_one();
+				}
+			});
+		}
+
+		{
+			std::unique_lock lock{mutex};
+			condition.wait(lock, [&remaining] { return remaining == 0; });
+		}
+
+		if(exception)
+		{
+			std::rethrow_exception(exception);
+		}
+
+		std::vector<std::filesystem::path> next{};
+		for(std::size_t index = 0; index < level.size(); ++index)
+		{
+			for(const auto& name : listings[index]->files)
+			{
+				files.push_back(level[index] / name);
+			}
+
+			if(current < depth)
+			{
+				for(const auto& name : listings[index]->directories)
+				{
+					next.push_back(level[index] / name);
+				}
+			}
+		}
+
+		level = std::move(next);
+	}
+
+	return files;
+}
+
+std::shared_ptr<const Walker::Listing> Walker::GetListing(const std::filesystem::path& directory)
+{
+	std::error_code error{};
+	const auto time = std::filesystem::last_write_time(directory, error);
+	if(error)
+	{
+		return std::make_shared<const Listing>();
+	}
+
+	// An unchanged directory still has the same entries
+	const auto key   = directory.lexically_normal().native();
+	const auto stamp = static_cast<std::int64_t>(time.time_since_epoch().count());
+	{
+		std::lock_guard lock{mutex_};
+		const auto iterator = listings_.find(key);
+		if(iterator != listings_.end() && iterator->second->time == stamp)
+		{
+			return iterator->second;
+		}
+	}
+
+	auto listing  = std::make_shared<Listing>();
+	listing->time = stamp;
+	try
+	{
+		for(const auto& entry : std::filesystem::directory_iterator{directory, error})
+		{
+			// Symbolic links to directories are not followed, so the walk can't loop
+			std::error_code status{};
+			if(entry.is_directory(status) && !entry.is_symlink(status))
+			{
+				listing->directories.push_back(entry.path().filename().native());
+			}
+			else if(entry.is_regular_file(status))
+			{
+				listing->files.push_back(entry.path().filename().native());
+			}
+		}
+	}
+	catch(const std::filesystem::filesystem_error&)
+	{
+		return std::make_shared<const Listing>();
+	}
+
+	std::sort(listing->files.begin(), listing->files.end());
+	std::sort(listing->directories.begin(), listing->directories.end());
+
+	std::lock_guard lock{mutex_};
+	listings_[key] = listing;
+	changed_       = true;
+	return listing;
+}
+
+void Walker::Load()
+{
+	try
+	{
+		const sys::MappedFile file{cache_};
+		Reader reader{file.GetData()};
+		if(reader.Read<std::uint32_t>() != constants::kMagic ||
+		   reader.Read<std::uint32_t>() != constants::kVersion)
+		{
+			return;
+		}
+
+		for(auto count = reader.Read<std::uint32_t>(); count && reader.IsValid(); --count)
+		{
+			auto directory = std::string{reader.ReadString()};
+			auto listing   = std::make_shared<Listing>();
+			listing->time        = reader.Read<std::int64_t>();
+			listing->files       = reader.ReadStrings();
+			listing->directories = reader.ReadStrings();
+			listings_.emplace(std::move(directory), std::move(listing));
+		}
+
+		// A truncated cache is treated as a missing one
+		if(!reader.IsValid())
+		{
+			listings_.clear();
+		}
+	}
+	catch(const ::exceptions::FileNotFoundException&)
+	{
+	}
+}
+
+bool Walker::Match(const std::string_view* pattern, const std::string_view* pattern_end,
+				   const std::string_view* path, const std::string_view* path_end)
+{
+	for(; pattern != pattern_end; ++pattern, ++path)
+	{
+		if(*pattern == constants::kRecursive)
+		{
+			// "**" matches any number of visible directories, the rest of the pattern must match the rest of the path
+			for(auto current = path;; ++current)
+			{
+				if(Match(pattern + 1, pattern_end, current, path_end))
+				{
+					return true;
+				}
+
+				if(current == path_end || current->front() == '.')
+				{
+					return false;
+				}
+			}
+		}
+
+		if(path == path_end)
+		{
+			return false;
+		}
+
+		const std::string segment{*pattern};
+		const std::string name{*path};
+		if(fnmatch(segment.c_str(), name.c_str(), FNM_PERIOD) != 0)
+		{
+			return false;
+		}
+	}
+
+	return path == path_end;
+}
+
+std::vector<std::string_view> Walker::Split(std::string_view value)
+{
+	std::vector<std::string_view> components{};
+	while(!value.empty())
+	{
+		const auto position  = value.find('/');
+		const auto component = value.substr(0, position);
+		if(!component.empty() && component != ".")
+		{
+			components.push_back(component);
+		}
+
+		if(position == std::string_view::npos)
+		{
+			break;
+		}
+
+		value.remove_prefix(position + 1);
+	}
+
+	return components;
+}
+} // namespace sys
\ No newline at end of file
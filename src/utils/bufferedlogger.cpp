@@ -33,13 +33,22 @@ void BufferedLogger::SetBufferLogLevel(LogLevel level) noexcept
 
 void BufferedLogger::Append(std::string_view message)
 {
+	// The message of a disabled level is not even built
+	if(!IsBuffering())
+	{
+		return;
+	}
+
 	// Append the message to the current buffer
 	buffer_ += message;
 }
 
 void BufferedLogger::Flush()
 {
-	Log(buffer_log_level_, buffer_);
+	if(IsBuffering())
+	{
+		Log(buffer_log_level_, buffer_);
+	}
 
 	// Clear the buffer and the current log level
 	buffer_.clear();
@@ -64,7 +73,11 @@ BufferedLogger& operator<<(BufferedLogger& logger, std::string_view value)
 
 BufferedLogger& operator<<(BufferedLogger& logger, int value)
 {
-	logger.Append(std::to_string(value));
+	if(logger.IsBuffering())
+	{
+		logger.Append(std::to_string(value));
+	}
+
 	return logger;
 }
 
@@ -0,0 +1,131 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "utils/console.hpp"
+
+namespace utils
+{
+std::mutex Console::mutex_;
+std::condition_variable Console::condition_{};
+std::vector<std::string> Console::blocks_{};
+std::thread Console::writer_{};
+bool Console::open_{false};
+bool Console::writing_{false};
+std::FILE* Console::stream_{stderr};
+std::string Console::focus_{};
+
+namespace
+{
+/**
+ * @brief Prints the pending blocks and stops the writer on exit, before the state above is destroyed
+ * 
+ */
+const struct Finalizer
+{
+	~Finalizer()
+	{
+		Console::Close();
+	}
+} kFinalizer{};
+} // namespace
+
+void Console::SetStream(std::FILE* stream)
+{
+	std::unique_lock<std::mutex> lock{mutex_};
+	stream_ = stream;
+}
+
+void Console::SetFocus(std::string_view job_name)
+{
+	std::unique_lock<std::mutex> lock{mutex_};
+	focus_ = job_name;
+}
+
+bool Console::IsFocused(std::string_view job_name)
+{
+	std::unique_lock<std::mutex> lock{mutex_};
+	return !focus_.empty() && focus_ == job_name;
+}
+
+void Console::Write(std::string block)
+{
+	std::unique_lock<std::mutex> lock{mutex_};
+	blocks_.push_back(std::move(block));
+
+	// The writer is only started, when there's something to print
+	if(!writer_.joinable())
+	{
+		open_   = true;
+		writer_ = std::thread{&Console::Work};
+	}
+
+	condition_.notify_all();
+}
+
+void Console::Flush()
+{
+	std::unique_lock<std::mutex> lock{mutex_};
+	condition_.wait(lock, [] { return blocks_.empty() && !writing_; });
+}
+
+void Console::Close()
+{
+	{
+		std::unique_lock<std::mutex> lock{mutex_};
+		open_ = false;
+	}
+
+	// The writer prints everything that's left before it stops
+	condition_.notify_all();
+	if(writer_.joinable())
+	{
+		writer_.join();
+	}
+}
+
+void Console::Work()
+{
+	std::unique_lock<std::mutex> lock{mutex_};
+	while(open_ || !blocks_.empty())
+	{
+		if(blocks_.empty())
+		{
+			condition_.wait(lock);
+			continue;
+		}
+
+		// The blocks are printed without the lock, so the workers are never stalled by the terminal
+		const auto blocks = std::move(blocks_);
+		const auto stream = stream_;
+		blocks_.clear();
+		writing_ = true;
+		lock.unlock();
+
+		for(const auto& block : blocks)
+		{
+			std::fwrite(block.data(), 1, block.size(), stream);
+		}
+		std::fflush(stream);
+
+		lock.lock();
+		writing_ = false;
+		condition_.notify_all();
+	}
+}
+} // namespace utils
\ No newline at end of file
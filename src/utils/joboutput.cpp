@@ -0,0 +1,122 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "utils/joboutput.hpp"
+
+#include <utility>
+
+#include "utils/console.hpp"
+
+namespace utils
+{
+JobOutput JobOutput::GetInstance(std::string_view job_name)
+{
+	return JobOutput{job_name};
+}
+
+JobOutput::JobOutput(JobOutput&& rhs)
+	: BufferedLogger{std::move(rhs)}
+	, focused_{rhs.focused_}
+	, line_start_{rhs.line_start_}
+{
+	// The moved-from output must not print anything, once it's destroyed
+	rhs.buffer_.clear();
+}
+
+JobOutput::~JobOutput()
+{
+	Flush();
+}
+
+void JobOutput::Capture(std::string_view data)
+{
+	if(data.empty())
+	{
+		return;
+	}
+
+	// The focused job is printed right away, the rest is kept until the action finishes
+	if(focused_)
+	{
+		std::string block{};
+		Prefix(block, data);
+		Console::Write(std::move(block));
+	}
+
+	buffer_ += data;
+}
+
+void JobOutput::Flush()
+{
+	if(buffer_.empty())
+	{
+		return;
+	}
+
+	if(!focused_)
+	{
+		std::string block{};
+		Prefix(block, buffer_);
+		Console::Write(std::move(block));
+	}
+	else if(!line_start_)
+	{
+		Console::Write("\n");
+	}
+
+	// The output is logged as one entry, the last line break is added by the logger
+	if(buffer_.back() == '\n')
+	{
+		buffer_.pop_back();
+	}
+
+	BufferedLogger::Flush();
+	line_start_ = true;
+}
+
+JobOutput::JobOutput(std::string_view job_name)
+	: BufferedLogger{job_name}
+	, focused_{Console::IsFocused(job_name)}
+{}
+
+void JobOutput::Prefix(std::string& block, std::string_view data)
+{
+	while(!data.empty())
+	{
+		if(line_start_)
+		{
+			block.append("[").append(component_name_).append("] ");
+		}
+
+		// Copy the data up to the end of the line, including the line break
+		const auto end  = data.find('\n');
+		const auto size = end == std::string_view::npos ? data.size() : end + 1;
+		block.append(data.substr(0, size));
+		data.remove_prefix(size);
+		line_start_ = end != std::string_view::npos;
+	}
+
+	// The block is always printed as whole lines
+	if(!focused_ && !line_start_)
+	{
+		block.push_back('\n');
+		line_start_ = true;
+	}
+}
+} // namespace utils
\ No newline at end of file
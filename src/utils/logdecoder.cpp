@@ -0,0 +1,216 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "utils/logdecoder.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+
+#include "utils/binary.hpp"
+#include "utils/exceptions/invalidlogexception.hpp"
+
+namespace utils
+{
+namespace constants
+{
+/**
+ * @brief The names of the log levels, in the order of their values
+ * 
+ */
+constexpr std::array<std::string_view, 5> kLevelNames{"debug", "warning", "error", "fatal", "info"};
+
+/**
+ * @brief The number of nanoseconds in a second
+ * 
+ */
+constexpr std::int64_t kNanoseconds = 1000000000;
+} // namespace constants
+
+LogDecoder::LogDecoder(Output output)
+	: output_{output}
+{}
+
+void LogDecoder::Decode(std::string_view data, std::ostream& stream)
+{
+	binary::Reader reader{data};
+	const auto offset = [&data, &reader] { return data.size() - reader.GetSize(); };
+	if(reader.Read<std::uint32_t>() != kMagic || reader.Read<std::uint32_t>() != kVersion)
+	{
+		throw exceptions::InvalidLogException(0);
+	}
+
+	std::string line{};
+	std::vector<LogFormat::Value> values{};
+	while(reader.GetSize())
+	{
+		const auto start = offset();
+		const auto tag   = static_cast<Tag>(reader.Read<std::uint8_t>());
+		switch(tag)
+		{
+		case Tag::kFormat:
+		case Tag::kComponent:
+		{
+			const auto id    = reader.Read<std::uint32_t>();
+			const auto value = reader.ReadString();
+			(tag == Tag::kFormat ? formats_ : components_)[id] = std::string{value};
+			break;
+		}
+		case Tag::kEntry:
+		{
+			const auto time      = reader.Read<std::int64_t>();
+			const auto level     = reader.Read<std::uint8_t>();
+			const auto component = components_.find(reader.Read<std::uint32_t>());
+			const auto format    = formats_.find(reader.Read<std::uint32_t>());
+			const auto arguments = reader.ReadString();
+
+			// The entry must only refer to the definitions that came before it
+			values.clear();
+			if(!reader.IsValid() || level >= constants::kLevelNames.size() || component == components_.end() ||
+			   format == formats_.end() || !LogFormat::Decode(arguments, values))
+			{
+				throw exceptions::InvalidLogException(start);
+			}
+
+			std::string message{};
+			LogFormat::Render(message, format->second, values);
+
+			line.clear();
+			output_ == Output::kJson ? AppendJson(line, time, static_cast<Logger::LogLevel>(level),
+												  component->second, format->second, message, values)
+									 : AppendText(line, time, component->second, message);
+			stream << line << '\n';
+			break;
+		}
+		default:
+			throw exceptions::InvalidLogException(start);
+		}
+
+		if(!reader.IsValid())
+		{
+			throw exceptions::InvalidLogException(start);
+		}
+	}
+}
+
+void LogDecoder::AppendText(std::string& line, std::int64_t time, std::string_view component_name,
+							std::string_view message)
+{
+	const auto seconds = static_cast<std::time_t>(time / constants::kNanoseconds);
+	std::tm local_time{};
+	localtime_r(&seconds, &local_time);
+
+	char buffer[32]{};
+	line.append(buffer, std::strftime(buffer, sizeof(buffer), LogFormat::kTimeFormat, &local_time));
+	line.append(" [").append(component_name).append("] ").append(message);
+}
+
+void LogDecoder::AppendJson(std::string& line, std::int64_t time, Logger::LogLevel level,
+							std::string_view component_name, std::string_view format, std::string_view message,
+							const std::vector<LogFormat::Value>& values)
+{
+	line.append("{\"time\":").append(std::to_string(time));
+	line.append(",\"level\":\"").append(constants::kLevelNames[static_cast<std::size_t>(level)]).append("\"");
+	line.append(",\"component\":");
+	AppendString(line, component_name);
+	line.append(",\"format\":");
+	AppendString(line, format);
+	line.append(",\"message\":");
+	AppendString(line, message);
+	line.append(",\"arguments\":[");
+	for(auto iterator = values.begin(); iterator != values.end(); ++iterator)
+	{
+		if(iterator != values.begin())
+		{
+			line.push_back(',');
+		}
+
+		// Only the strings are quoted, the numbers are kept as they are
+		if(const auto* string = std::get_if<std::string_view>(&*iterator))
+		{
+			AppendString(line, *string);
+		}
+		else if(const auto* number = std::get_if<double>(&*iterator))
+		{
+			AppendNumber(line, *number);
+		}
+		else
+		{
+			LogFormat::Append(line, *iterator);
+		}
+	}
+
+	line.append("]}");
+}
+
+void LogDecoder::AppendNumber(std::string& line, double value)
+{
+	// JSON has no literals for NaN and the infinities
+	if(!std::isfinite(value))
+	{
+		line.append("null");
+		return;
+	}
+
+	// The number is printed with enough digits to be read back exactly
+	char buffer[32]{};
+	const auto size = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+	line.append(buffer, static_cast<std::size_t>(size));
+}
+
+void LogDecoder::AppendString(std::string& line, std::string_view value)
+{
+	line.push_back('"');
+	for(const auto character : value)
+	{
+		switch(character)
+		{
+		case '"':
+			line.append("\\\"");
+			break;
+		case '\\':
+			line.append("\\\\");
+			break;
+		case '\n':
+			line.append("\\n");
+			break;
+		case '\r':
+			line.append("\\r");
+			break;
+		case '\t':
+			line.append("\\t");
+			break;
+		default:
+			if(static_cast<unsigned char>(character) < 0x20)
+			{
+				char buffer[8]{};
+				std::snprintf(buffer, sizeof(buffer), "\\u%04x", character);
+				line.append(buffer);
+			}
+			else
+			{
+				line.push_back(character);
+			}
+		}
+	}
+
+	line.push_back('"');
+}
+} // namespace utils
\ No newline at end of file
@@ -0,0 +1,200 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "utils/logformat.hpp"
+
+#include <cstdio>
+#include <deque>
+#include <mutex>
+
+namespace utils
+{
+namespace constants
+{
+/**
+ * @brief The placeholder of an argument in the format strings
+ * 
+ */
+constexpr std::string_view kPlaceholder = "{}";
+} // namespace constants
+
+namespace
+{
+/**
+ * @brief The registered format strings, the plain message is always the first one
+ * 
+ */
+struct Registry
+{
+	std::mutex mutex;
+	std::deque<std::string> formats{std::string{constants::kPlaceholder}};
+};
+
+/**
+ * @brief Get the registry of the format strings, created on the first use
+ * 
+ * @return Registry& - the registry
+ */
+Registry& GetRegistry()
+{
+	static Registry registry{};
+	return registry;
+}
+
+/**
+ * @brief Read the fixed-size value from the data
+ * 
+ * @param data - the data to read from, the value is removed from it
+ * @param value - the value to read into
+ * @return true if there was enough data, false otherwise
+ */
+template<typename T>
+bool Read(std::string_view& data, T& value)
+{
+	if(data.size() < sizeof(value))
+	{
+		return false;
+	}
+
+	std::memcpy(&value, data.data(), sizeof(value));
+	data.remove_prefix(sizeof(value));
+	return true;
+}
+} // namespace
+
+LogFormat::LogFormat(std::string_view format)
+{
+	auto& registry = GetRegistry();
+	std::lock_guard lock{registry.mutex};
+	id_ = static_cast<Id>(registry.formats.size());
+	registry.formats.emplace_back(format);
+}
+
+LogFormat::Id LogFormat::GetId() const noexcept
+{
+	return id_;
+}
+
+std::string_view LogFormat::GetFormat(Id id)
+{
+	// The strings stay in place, so the view outlives the lock
+	auto& registry = GetRegistry();
+	std::lock_guard lock{registry.mutex};
+	return id < registry.formats.size() ? std::string_view{registry.formats[id]} : std::string_view{};
+}
+
+bool LogFormat::Decode(std::string_view arguments, std::vector<Value>& values)
+{
+	while(!arguments.empty())
+	{
+		const auto type = static_cast<Type>(arguments.front());
+		arguments.remove_prefix(1);
+		switch(type)
+		{
+		case Type::kSigned:
+		{
+			std::int64_t value{};
+			if(!Read(arguments, value))
+			{
+				return false;
+			}
+
+			values.emplace_back(value);
+			break;
+		}
+		case Type::kUnsigned:
+		{
+			std::uint64_t value{};
+			if(!Read(arguments, value))
+			{
+				return false;
+			}
+
+			values.emplace_back(value);
+			break;
+		}
+		case Type::kDouble:
+		{
+			double value{};
+			if(!Read(arguments, value))
+			{
+				return false;
+			}
+
+			values.emplace_back(value);
+			break;
+		}
+		case Type::kString:
+		{
+			std::uint32_t size{};
+			if(!Read(arguments, size) || arguments.size() < size)
+			{
+				return false;
+			}
+
+			values.emplace_back(arguments.substr(0, size));
+			arguments.remove_prefix(size);
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void LogFormat::Render(std::string& output, std::string_view format, const std::vector<Value>& values)
+{
+	// The placeholders without the values are kept as they are
+	auto value = values.begin();
+	for(auto position = format.find(constants::kPlaceholder);
+		position != std::string_view::npos && value != values.end();
+		position = format.find(constants::kPlaceholder))
+	{
+		output.append(format.substr(0, position));
+		Append(output, *value++);
+		format.remove_prefix(position + constants::kPlaceholder.size());
+	}
+
+	output.append(format);
+}
+
+void LogFormat::Append(std::string& output, const Value& value)
+{
+	if(const auto* string = std::get_if<std::string_view>(&value))
+	{
+		output.append(*string);
+	}
+	else if(const auto* number = std::get_if<double>(&value))
+	{
+		char buffer[32]{};
+		const auto size = std::snprintf(buffer, sizeof(buffer), "%g", *number);
+		output.append(buffer, static_cast<std::size_t>(size));
+	}
+	else if(const auto* integer = std::get_if<std::int64_t>(&value))
+	{
+		output.append(std::to_string(*integer));
+	}
+	else
+	{
+		output.append(std::to_string(std::get<std::uint64_t>(value)));
+	}
+}
+} // namespace utils
\ No newline at end of file
@@ -19,28 +19,120 @@
 
 #include "utils/logger.hpp"
 
-#include <ctime>
-#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+#include "utils/binary.hpp"
+#include "utils/logdecoder.hpp"
 
 namespace utils
 {
+namespace constants
+{
+/**
+ * @brief The size of the buffer of every thread
+ * 
+ */
+constexpr std::size_t kBufferSize = 64 * 1024;
+
+/**
+ * @brief The interval the writer drains the buffers at
+ * 
+ */
+constexpr std::chrono::milliseconds kInterval{10};
+
+/**
+ * @brief The number of nanoseconds in a second
+ * 
+ */
+constexpr std::int64_t kNanoseconds = 1000000000;
+} // namespace constants
+
+namespace
+{
+/**
+ * @brief The fixed-size part of an entry in the buffer, followed by the component name and the arguments
+ * 
+ */
+struct Header
+{
+	std::int64_t time;
+	LogFormat::Id format;
+	std::uint16_t component_name_size;
+	Logger::LogLevel level;
+};
+
+/**
+ * @brief Get the view of the object's bytes
+ * 
+ * @param value - the object to view
+ * @return std::string_view - the bytes of the object
+ */
+template<typename T>
+std::string_view AsBytes(const T& value)
+{
+	return {reinterpret_cast<const char*>(&value), sizeof(value)};
+}
+} // namespace
+
 std::ofstream Logger::stream_{};
 std::mutex Logger::mutex_;
 Logger::LogLevel Logger::minimum_log_level_{LogLevel::kDebug};
+std::atomic<bool> Logger::open_{false};
+std::vector<std::shared_ptr<RingBuffer>> Logger::buffers_{};
+std::thread Logger::writer_{};
+std::condition_variable Logger::condition_{};
+std::time_t Logger::time_{-1};
+std::string Logger::timestamp_{};
+Logger::Sink Logger::sink_{Sink::kText};
+std::vector<bool> Logger::formats_{};
+std::map<std::string, std::uint32_t, std::less<>> Logger::components_{};
 
-void Logger::SetFile(std::string_view file)
+namespace
 {
-	std::unique_lock<std::mutex> lock{mutex_};
+/**
+ * @brief Writes the pending entries and stops the writer on exit, before the state above is destroyed
+ * 
+ */
+const struct Finalizer
+{
+	~Finalizer()
+	{
+		Logger::Close();
+	}
+} kFinalizer{};
+} // namespace
 
+void Logger::SetFile(std::string_view file, Sink sink)
+{
 	// Close the previous file, if any
 	Close();
 
+	std::unique_lock<std::mutex> lock{mutex_};
+
 	// Open the new file
-	stream_.open(std::string(file));
+	stream_.open(std::string(file), sink == Sink::kBinary ? std::ios::binary : std::ios::out);
 	if(!stream_.is_open())
 	{
 		return;
 	}
+
+	// A binary file starts with it's own definitions of the formats and the components
+	sink_ = sink;
+	formats_.clear();
+	components_.clear();
+	if(sink_ == Sink::kBinary)
+	{
+		std::string header{};
+		binary::Write(header, LogDecoder::kMagic);
+		binary::Write(header, LogDecoder::kVersion);
+		stream_.write(header.data(), static_cast<std::streamsize>(header.size()));
+	}
+
+	open_ = true;
+	writer_ = std::thread{&Logger::Work};
 }
 
 void Logger::SetMinimumLogLevel(LogLevel level) noexcept
@@ -55,34 +147,219 @@ Logger Logger::GetInstance(std::string_view component_name)
 
 void Logger::Close()
 {
-	// If the previous file was opened, close it
+	// Stop accepting the entries and let the writer finish
+	open_ = false;
+	condition_.notify_all();
+	if(writer_.joinable())
+	{
+		writer_.join();
+	}
+
+	// If the previous file was opened, write what's left and close it
+	std::unique_lock<std::mutex> lock{mutex_};
 	if(stream_.is_open())
 	{
+		Drain();
 		stream_.close();
 	}
 }
 
+void Logger::Flush()
+{
+	std::unique_lock<std::mutex> lock{mutex_};
+	if(stream_.is_open())
+	{
+		Drain();
+		stream_.flush();
+	}
+}
+
 void Logger::Log(LogLevel level, std::string_view message) const
 {
 	// Don't add the entry, if it's level is less than minimum
-	if(level < minimum_log_level_ || !stream_.is_open())
+	if(!IsEnabled(level) || !open_.load(std::memory_order_relaxed))
 	{
 		return;
 	}
 
-	std::unique_lock<std::mutex> lock{mutex_};
-
-	// Get the current time
-	auto time = std::time(nullptr);
-	auto local_time = *std::localtime(&time);
-
-	// Put the log entry into the file
-	stream_ << std::put_time(&local_time, "%d.%m.%Y %H:%M:%S") << " [" << component_name_ << "] "
-			<< message << std::endl
-			<< std::flush;
+	const LogFormat::Argument argument{message};
+	Write(level, LogFormat::kMessage, &argument, 1);
 }
 
 Logger::Logger(std::string_view component_name)
 	: component_name_{component_name}
 {}
+
+void Logger::Write(LogLevel level, LogFormat::Id format, const LogFormat::Argument* arguments,
+				   std::size_t count) const
+{
+	// The entry is formatted by the writer, only the raw data is copied here
+	const auto now = std::chrono::system_clock::now().time_since_epoch();
+	const Header header{std::chrono::duration_cast<std::chrono::nanoseconds>(now).count(), format,
+						static_cast<std::uint16_t>(component_name_.size()), level};
+
+	std::array<std::string_view, 2 + 2 * kMaximumArguments> parts{AsBytes(header), component_name_};
+	for(std::size_t index = 0; index < count; ++index)
+	{
+		parts[2 + 2 * index]     = arguments[index].GetHead();
+		parts[2 + 2 * index + 1] = arguments[index].GetTail();
+	}
+
+	const auto size = 2 + 2 * count;
+	auto& buffer    = GetBuffer();
+	if(buffer.Write(parts.data(), size))
+	{
+		return;
+	}
+
+	// The writer is behind, so the buffer is drained in place
+	std::unique_lock<std::mutex> lock{mutex_};
+	Drain();
+	if(!buffer.Write(parts.data(), size) && stream_.is_open())
+	{
+		// The entry is larger than the buffer itself, so it's written directly
+		std::string data{};
+		for(std::size_t index = 0; index < count; ++index)
+		{
+			data.append(arguments[index].GetHead()).append(arguments[index].GetTail());
+		}
+
+		std::string batch{};
+		sink_ == Sink::kBinary ? Encode(batch, header.time, level, component_name_, format, data)
+							   : Format(batch, header.time, component_name_, format, data);
+		stream_.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+	}
+}
+
+RingBuffer& Logger::GetBuffer()
+{
+	thread_local const auto buffer = [] {
+		auto result = std::make_shared<RingBuffer>(constants::kBufferSize);
+		std::unique_lock<std::mutex> lock{mutex_};
+		buffers_.push_back(result);
+		return result;
+	}();
+
+	return *buffer;
+}
+
+void Logger::Drain()
+{
+	// The records are copied out of the buffers and merged by their time, as every thread has it's own buffer
+	std::string records{};
+	std::vector<std::pair<std::int64_t, std::size_t>> offsets{};
+	for(auto& buffer : buffers_)
+	{
+		buffer->Read([&records, &offsets](std::string_view record) {
+			Header header{};
+			std::memcpy(&header, record.data(), sizeof(header));
+			offsets.emplace_back(header.time, records.size());
+
+			const auto size = static_cast<std::uint32_t>(record.size());
+			records.append(AsBytes(size)).append(record);
+		});
+	}
+
+	std::stable_sort(offsets.begin(), offsets.end(),
+					 [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+	std::string batch{};
+	for(const auto& [time, offset] : offsets)
+	{
+		std::uint32_t size{};
+		std::memcpy(&size, records.data() + offset, sizeof(size));
+		auto record = std::string_view{records}.substr(offset + sizeof(size), size);
+
+		Header header{};
+		std::memcpy(&header, record.data(), sizeof(header));
+		record.remove_prefix(sizeof(header));
+
+		const auto component_name = record.substr(0, header.component_name_size);
+		const auto arguments      = record.substr(header.component_name_size);
+		sink_ == Sink::kBinary
+			? Encode(batch, header.time, header.level, component_name, header.format, arguments)
+			: Format(batch, header.time, component_name, header.format, arguments);
+	}
+
+	// The buffers of the finished threads are dropped, once they are empty
+	buffers_.erase(std::remove_if(buffers_.begin(), buffers_.end(),
+								  [](const auto& buffer) { return buffer.use_count() == 1 && buffer->IsEmpty(); }),
+				   buffers_.end());
+
+	if(!batch.empty() && stream_.is_open())
+	{
+		stream_.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+	}
+}
+
+void Logger::Format(std::string& batch, std::int64_t time, std::string_view component_name,
+					LogFormat::Id format, std::string_view arguments)
+{
+	// The local time is only computed when the second changes
+	const auto seconds = static_cast<std::time_t>(time / constants::kNanoseconds);
+	if(seconds != time_)
+	{
+		std::tm local_time{};
+		localtime_r(&seconds, &local_time);
+
+		char buffer[32]{};
+		timestamp_.assign(buffer, std::strftime(buffer, sizeof(buffer), LogFormat::kTimeFormat, &local_time));
+		time_ = seconds;
+	}
+
+	batch.append(timestamp_).append(" [").append(component_name).append("] ");
+
+	std::vector<LogFormat::Value> values{};
+	LogFormat::Decode(arguments, values);
+	LogFormat::Render(batch, LogFormat::GetFormat(format), values);
+	batch.push_back('\n');
+}
+
+void Logger::Encode(std::string& batch, std::int64_t time, LogLevel level, std::string_view component_name,
+					LogFormat::Id format, std::string_view arguments)
+{
+	using Tag = LogDecoder::Tag;
+
+	// The format strings and the component names are only written before their first use
+	if(format >= formats_.size())
+	{
+		formats_.resize(format + 1, false);
+	}
+
+	if(!formats_[format])
+	{
+		formats_[format] = true;
+		binary::Write(batch, Tag::kFormat);
+		binary::Write(batch, format);
+		binary::Write(batch, LogFormat::GetFormat(format));
+	}
+
+	auto iterator = components_.find(component_name);
+	if(iterator == components_.end())
+	{
+		const auto id = static_cast<std::uint32_t>(components_.size());
+		iterator      = components_.emplace(std::string{component_name}, id).first;
+		binary::Write(batch, Tag::kComponent);
+		binary::Write(batch, id);
+		binary::Write(batch, component_name);
+	}
+
+	binary::Write(batch, Tag::kEntry);
+	binary::Write(batch, time);
+	binary::Write(batch, static_cast<std::uint8_t>(level));
+	binary::Write(batch, iterator->second);
+	binary::Write(batch, format);
+	binary::Write(batch, arguments);
+}
+
+void Logger::Work()
+{
+	std::unique_lock<std::mutex> lock{mutex_};
+	while(open_)
+	{
+		Drain();
+		stream_.flush();
+		condition_.wait_for(lock, constants::kInterval);
+	}
+}
 } // namespace utils
\ No newline at end of file
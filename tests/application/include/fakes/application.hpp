@@ -0,0 +1,47 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+// The fake shares the name of the header, so the include directories are searched
+#include <application.hpp>
+
+namespace fakes
+{
+/**
+ * @brief The application implementation that puts everything together
+ * 
+ */
+class Application : public ::Application
+{
+public:
+	/**
+	 * @brief Construct a new Application object
+	 * 
+	 * @param jobs - the number of actions to run simultaneously
+	 */
+	explicit Application(std::size_t jobs = 1)
+		: ::Application{jobs}
+	{}
+
+public:
+	using ::Application::Normalize;
+	using ::Application::projects_;
+};
+} // namespace fakes
\ No newline at end of file
@@ -21,9 +21,10 @@
 
 #include <filesystem>
 
-#include "application.hpp"
 #include "scheduler/exceptions/linkerrorexception.hpp"
 
+#include "fakes/application.hpp"
+
 extern bool is_faulty;
 
 /**
@@ -37,7 +38,7 @@ protected:
 	 * @brief The instance to test
 	 * 
 	 */
-	Application instance_{};
+	fakes::Application instance_{};
 };
 
 /**
@@ -63,6 +64,27 @@ TEST_F(ApplicationTest, TestProcessExceptionCaught)
 	is_faulty = false;
 }
 
+/**
+ * @brief Check if the project is added to the graph once, even if it is processed again
+ * 
+ */
+TEST_F(ApplicationTest, TestProcessGraph)
+{
+	instance_.Process(std::filesystem::path{""});
+	instance_.Process(std::filesystem::path{""});
+
+	EXPECT_EQ(instance_.projects_.size(), 1);
+}
+
+/**
+ * @brief Check if different spellings of the same path identify the same project
+ * 
+ */
+TEST_F(ApplicationTest, TestNormalize)
+{
+	EXPECT_EQ(fakes::Application::Normalize("a/../b/./c"), fakes::Application::Normalize("b/c"));
+}
+
 /**
  * @brief Check if the Build() method correctly works
  * 
@@ -21,9 +21,13 @@
 
 namespace scheduler
 {
+Executor::Executor(std::size_t jobs)
+	: pool_{jobs}
+{}
+
 void Executor::Add(pipeline::Pipeline pipeline)
 {
-	pipeline.Run();
+	pipeline.Run(pool_);
 }
 
 void Executor::Run()
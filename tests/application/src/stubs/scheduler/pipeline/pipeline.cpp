@@ -25,11 +25,13 @@ bool is_faulty = false;
 
 namespace scheduler::pipeline
 {
-Pipeline::Pipeline(Job job)
+Pipeline::Pipeline(Job job, bool unity)
 	: job_{std::move(job)}
+	, unity_{unity}
+	, logger_{utils::Logger::GetInstance("")}
 {}
 
-void Pipeline::Run() const
+void Pipeline::Run(ThreadPool& pool) const
 {
 	if(is_faulty)
 	{
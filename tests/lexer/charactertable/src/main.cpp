@@ -0,0 +1,90 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <cctype>
+
+#include <gtest/gtest.h>
+
+#include "lexer/charactertable.hpp"
+
+using lexer::CharacterClass;
+using lexer::kCharacterTable;
+
+/**
+ * @brief Get the entry of the table for the given character
+ * 
+ * @param character - the character to look up
+ * @return lexer::CharacterEntry - the entry of the character
+ */
+static lexer::CharacterEntry Lookup(char character)
+{
+	return kCharacterTable[static_cast<unsigned char>(character)];
+}
+
+/**
+ * @brief Check if all the alphabetical characters are letters
+ * 
+ */
+TEST(CharacterTableTest, TestLetters)
+{
+	for(int character = 0; character < 256; ++character)
+	{
+		const auto expected = std::isalpha(character) != 0;
+		EXPECT_EQ(kCharacterTable[character].type == CharacterClass::kLetter, expected) << character;
+	}
+}
+
+/**
+ * @brief Check if the table agrees with the maps of the tokens
+ * 
+ */
+TEST(CharacterTableTest, TestTokens)
+{
+	using namespace parser::tokens;
+
+	for(const auto& [character, type] : Punctuator::kPunctuatorToTypeMap)
+	{
+		EXPECT_EQ(Lookup(character).type, CharacterClass::kPunctuator);
+		EXPECT_EQ(Lookup(character).subtype, static_cast<uint8_t>(type));
+	}
+
+	for(const auto& [character, type] : Separator::kSeparatorToTypeMap)
+	{
+		EXPECT_EQ(Lookup(character).type, CharacterClass::kSeparator);
+		EXPECT_EQ(Lookup(character).subtype, static_cast<uint8_t>(type));
+	}
+
+	for(const auto& [character, type] : Operator::kOperatorToTypeMap)
+	{
+		EXPECT_EQ(Lookup(character).type, CharacterClass::kOperator);
+		EXPECT_EQ(Lookup(character).subtype, static_cast<uint8_t>(type));
+	}
+}
+
+/**
+ * @brief Check if the characters unknown to the language are invalid
+ * 
+ */
+TEST(CharacterTableTest, TestInvalid)
+{
+	EXPECT_EQ(Lookup('\t').type, CharacterClass::kInvalid);
+	EXPECT_EQ(Lookup('0').type, CharacterClass::kInvalid);
+	EXPECT_EQ(Lookup('\0').type, CharacterClass::kInvalid);
+	EXPECT_EQ(Lookup('\xff').type, CharacterClass::kInvalid);
+}
\ No newline at end of file
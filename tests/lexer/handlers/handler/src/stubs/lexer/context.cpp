@@ -19,28 +19,26 @@
 
 #include "lexer/context.hpp"
 
-#include <iterator>
-
 namespace lexer
 {
-void Context::Update(std::string&& value)
+void Context::Update(std::string_view value)
 {
-	line_ = std::move(value);
-	position_ = line_.begin();
+	line_ = value;
+	position_ = 0;
 }
 
-std::string Context::GetLine() const
+std::string_view Context::GetLine() const
 {
 	return line_;
 }
 
 std::optional<char> Context::GetCharacter() const
 {
-	if(position_ == line_.end())
+	if(position_ >= line_.size())
 	{
 		return {};
 	}
-	return *position_;
+	return line_[position_];
 }
 
 void Context::Next()
@@ -18,6 +18,7 @@
  */
 
 #include <filesystem>
+#include <fstream>
 
 #include <gtest/gtest.h>
 
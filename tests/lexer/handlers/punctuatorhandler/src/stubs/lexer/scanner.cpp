@@ -19,37 +19,25 @@
 
 #include "lexer/scanner.hpp"
 
-#include "exceptions/filenotfoundexception.hpp"
-
 namespace lexer
 {
 Scanner::Scanner(const std::filesystem::path& path)
+	: file_{path}
+	, data_{file_.GetData()}
 {
-	file_.open(path);
-	if(!file_.is_open())
-	{
-		throw ::exceptions::FileNotFoundException(path);
-	}
-
 	// Get the first line from file and initialize the iterator
-	std::string line;
-	std::getline(file_, line);
-	context_.Update(std::move(line));
+	context_.Update(data_.substr(0, data_.find('\n')));
 }
 
 Scanner::~Scanner()
 {
-	// Close the file
-	if(file_.is_open())
-	{
-		file_.close();
-	}
+	// noop
 }
 
 std::optional<char> Scanner::Get()
 {
 	// Don't return anything if the file is closed
-	if(!file_.is_open())
+	if(finished_)
 	{
 		return {};
 	}
@@ -60,7 +48,7 @@ std::optional<char> Scanner::Get()
 void Scanner::Move()
 {
 	// Don't return anything if the file is closed
-	if(!file_.is_open())
+	if(finished_)
 	{
 		return;
 	}
@@ -68,6 +56,19 @@ void Scanner::Move()
 	context_.Next();
 }
 
+void Scanner::Move(std::size_t count)
+{
+	for(std::size_t index = 0; index < count; ++index)
+	{
+		context_.Next();
+	}
+}
+
+std::string_view Scanner::Peek() const
+{
+	return context_.GetLine().substr(context_.GetPosition());
+}
+
 const lexer::Context& Scanner::GetContext() const
 {
 	return context_;
@@ -77,4 +78,9 @@ void Scanner::Skip()
 {
 	// noop
 }
+
+bool Scanner::Read()
+{
+	return false;
+}
 } // namespace lexer
\ No newline at end of file
@@ -32,7 +32,9 @@ const std::map<char, Punctuator::Type> Punctuator::kPunctuatorToTypeMap{
 	{',', Type::kComma},
 	{'/', Type::kSlash},
 	{'\\', Type::kBackslash},
-	{'-', Type::kMinus}};
+	{'-', Type::kMinus},
+	{'*', Type::kAsterisk},
+	{'?', Type::kQuestionMark}};
 
 Punctuator::Punctuator(Type type_)
 	: Token{}
@@ -46,4 +48,9 @@ std::string Punctuator::GetValue() const
 									   [&](const auto& pair) { return pair.second == type; });
 	return std::string(iterator->first, 1);
 }
+
+Lexeme Punctuator::ToLexeme() const
+{
+	return {Lexeme::Kind::kPunctuator, static_cast<uint8_t>(type), {}};
+}
 } // namespace parser::tokens
\ No newline at end of file
@@ -30,4 +30,9 @@ std::string Word::GetValue() const
 {
 	return value_;
 }
+
+Lexeme Word::ToLexeme() const
+{
+	return {Lexeme::Kind::kWord, 0, value_};
+}
 } // namespace parser::tokens
\ No newline at end of file
@@ -52,7 +52,7 @@ TEST_F(LexerTest, TestNext)
 
 	// Create a mock to check if the next handler is called
 	const auto mock = new mocks::lexer::handlers::Handler();
-	instance_.handler_ = std::unique_ptr<::lexer::handlers::Handler>(mock);
+	instance_.SetHandler(std::unique_ptr<::lexer::handlers::Handler>(mock));
 
 	// Expect the mock to be called
 	EXPECT_NO_THROW(instance_.Next());
@@ -60,4 +60,15 @@ TEST_F(LexerTest, TestNext)
 
 	// Allow leak since the pointer will be deleted by the unique_ptr wrapper
 	testing::Mock::AllowLeak(mock);
+}
+
+/**
+ * @brief Check if the default scanning returns nothing at the end of the file
+ * 
+ */
+TEST_F(LexerTest, TestNextEndOfFile)
+{
+	EXPECT_EQ(instance_.handler_, nullptr);
+	EXPECT_EQ(instance_.Next(), nullptr);
+	EXPECT_EQ(instance_.Get(), nullptr);
 }
\ No newline at end of file
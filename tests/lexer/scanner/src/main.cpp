@@ -18,6 +18,7 @@
  */
 
 #include <filesystem>
+#include <fstream>
 
 #include <gtest/gtest.h>
 
@@ -212,4 +213,43 @@ TEST_F(ScannerTest, TestGetContext)
 	const auto context = instance.GetContext();
 	EXPECT_EQ(context.GetLine(), data);
 	EXPECT_EQ(context.GetLineIndex(), 2);
+}
+
+/**
+ * @brief Check if the Peek() method returns the rest of the current line as a view into the file
+ * 
+ */
+TEST_F(ScannerTest, TestPeek)
+{
+	const std::string data{"Hello World!"};
+
+	// Write some test data after a comment
+	file << "# Goodbye World" << std::endl << data << std::endl;
+
+	fake::Scanner instance{kFilePath};
+	EXPECT_EQ(instance.Peek(), data);
+
+	instance.Move(6);
+	EXPECT_EQ(instance.Peek(), "World!");
+	EXPECT_EQ(instance.GetContext().GetPosition(), 6);
+}
+
+/**
+ * @brief Check if the Scanner component moves to the next line after consuming the whole current one
+ * 
+ */
+TEST_F(ScannerTest, TestMoveCountNewLine)
+{
+	// The last line is not terminated
+	file << "Hello" << std::endl << "World" << std::flush;
+
+	fake::Scanner instance{kFilePath};
+	instance.Move(5);
+
+	EXPECT_EQ(instance.Peek(), "World");
+	EXPECT_EQ(instance.GetContext().GetLineIndex(), 2);
+
+	instance.Move(5);
+	EXPECT_FALSE(instance.Get());
+	EXPECT_TRUE(instance.Peek().empty());
 }
\ No newline at end of file
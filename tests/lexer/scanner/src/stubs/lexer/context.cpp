@@ -19,31 +19,29 @@
 
 #include "lexer/context.hpp"
 
-#include <iterator>
-
 namespace lexer
 {
-void Context::Update(std::string&& value)
+void Context::Update(std::string_view value)
 {
-	line_ = std::move(value);
-	position_ = line_.begin();
+	line_ = value;
+	position_ = 0;
 
 	// Increment the index of the line
 	++line_index_;
 }
 
-std::string Context::GetLine() const
+std::string_view Context::GetLine() const
 {
 	return line_;
 }
 
 std::optional<char> Context::GetCharacter() const
 {
-	if(position_ == line_.end())
+	if(position_ >= line_.size())
 	{
 		return {};
 	}
-	return *position_;
+	return line_[position_];
 }
 
 void Context::Next()
@@ -58,6 +56,6 @@ std::size_t Context::GetLineIndex() const
 
 std::size_t Context::GetPosition() const
 {
-	return {};
+	return position_;
 }
 } // namespace lexer
\ No newline at end of file
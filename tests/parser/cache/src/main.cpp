@@ -0,0 +1,162 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "parser/cache.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief A text fixture to test parser::Cache component
+ * 
+ */
+class CacheTest : public ::testing::Test
+{
+protected:
+	/**
+	 * @brief Write the build file
+	 * 
+	 * @param data - the contents of the file
+	 */
+	void WriteBuildFile(const std::string& data)
+	{
+		std::ofstream file{kFilePath};
+		file << data;
+	}
+
+	/**
+	 * @brief Remove the files created by the test
+	 * 
+	 */
+	void TearDown() override
+	{
+		fs::remove(kFilePath);
+		fs::remove_all(kDirectory);
+	}
+
+protected:
+	/**
+	 * @brief The build file, used by the test suite
+	 * 
+	 */
+	static const fs::path kFilePath;
+
+	/**
+	 * @brief The cache directory, used by the test suite
+	 * 
+	 */
+	static const fs::path kDirectory;
+
+	/**
+	 * @brief The instance to test
+	 * 
+	 */
+	parser::Cache instance_{kDirectory};
+};
+
+const fs::path CacheTest::kFilePath{"cache.bbs"};
+const fs::path CacheTest::kDirectory{"entries"};
+
+/**
+ * @brief Check if the stored job is loaded back unchanged
+ * 
+ */
+TEST_F(CacheTest, TestLoad)
+{
+	WriteBuildFile("!prj \"test\"");
+
+	scheduler::pipeline::Job job{"test"};
+	job.SetCompilationFlags("-O2");
+	job.AddFile("main.cpp");
+	job.AddFile("util.cpp");
+	job.AddDependency("library");
+	job.AddIncludeDirectory("include");
+	job.SetPreCompilationCommands({{"echo pre", {"input.txt"}, {"output.cpp"}}});
+	job.SetPostCompilationCommands({{"echo post"}, {"echo done", {}, {}, true}});
+	job.SetPrecompiledHeader("common.hpp");
+	job.AddIsolatedFile("legacy.cpp");
+	instance_.Store(kFilePath, job);
+
+	const auto result = instance_.Load(kFilePath);
+	ASSERT_TRUE(result);
+	EXPECT_EQ(result->GetProjectName(), job.GetProjectName());
+	EXPECT_EQ(result->GetCompilationFlags(), job.GetCompilationFlags());
+	EXPECT_EQ(result->GetFiles(), job.GetFiles());
+	EXPECT_EQ(result->GetDependencies(), job.GetDependencies());
+	EXPECT_EQ(result->GetIncludeDirectories(), job.GetIncludeDirectories());
+	EXPECT_EQ(result->GetPreCompilationCommands(), job.GetPreCompilationCommands());
+	EXPECT_EQ(result->GetPostCompilationCommands(), job.GetPostCompilationCommands());
+	EXPECT_EQ(result->GetPrecompiledHeader(), job.GetPrecompiledHeader());
+	EXPECT_EQ(result->GetIsolatedFiles(), job.GetIsolatedFiles());
+}
+
+/**
+ * @brief Check if nothing is loaded if the job was never stored
+ * 
+ */
+TEST_F(CacheTest, TestLoadMissingEntry)
+{
+	WriteBuildFile("!prj \"test\"");
+
+	EXPECT_FALSE(instance_.Load(kFilePath));
+}
+
+/**
+ * @brief Check if nothing is loaded if the build file doesn't exist
+ * 
+ */
+TEST_F(CacheTest, TestLoadMissingBuildFile)
+{
+	EXPECT_FALSE(instance_.Load(kFilePath));
+}
+
+/**
+ * @brief Check if the entry is invalidated by a change of the build file
+ * 
+ */
+TEST_F(CacheTest, TestLoadChangedBuildFile)
+{
+	WriteBuildFile("!prj \"test\"");
+	instance_.Store(kFilePath, scheduler::pipeline::Job{"test"});
+
+	WriteBuildFile("!prj \"other\"");
+	EXPECT_FALSE(instance_.Load(kFilePath));
+}
+
+/**
+ * @brief Check if a truncated entry is not loaded
+ * 
+ */
+TEST_F(CacheTest, TestLoadTruncatedEntry)
+{
+	WriteBuildFile("!prj \"test\"");
+	instance_.Store(kFilePath, scheduler::pipeline::Job{"test"});
+
+	// Cut the job off the entry, leaving the header only
+	for(const auto& entry : fs::directory_iterator{kDirectory})
+	{
+		fs::resize_file(entry.path(), 20);
+	}
+
+	EXPECT_FALSE(instance_.Load(kFilePath));
+}
\ No newline at end of file
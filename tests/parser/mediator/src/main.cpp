@@ -23,7 +23,6 @@
 #include "parser/exceptions/nonexistentprojectexception.hpp"
 #include "parser/exceptions/undeclaredvariableexception.hpp"
 #include "parser/mediator.hpp"
-#include "parser/states/state.hpp"
 
 /**
  * @brief A text fixture to test parser::MediatorTest component
@@ -45,8 +44,18 @@ protected:
  */
 TEST_F(MediatorTest, TestSetState)
 {
-	instance_.SetState({});
-	EXPECT_FALSE(instance_.GetState());
+	instance_.SetState(parser::states::Type::kKeyword);
+	EXPECT_EQ(instance_.GetState(), parser::states::Type::kKeyword);
+}
+
+/**
+ * @brief Check if the parser starts with the Statement state and stops once it is taken
+ * 
+ */
+TEST_F(MediatorTest, TestGetState)
+{
+	EXPECT_EQ(instance_.GetState(), parser::states::Type::kStatement);
+	EXPECT_EQ(instance_.GetState(), parser::states::Type::kNone);
 }
 
 /**
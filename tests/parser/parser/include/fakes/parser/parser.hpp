@@ -40,6 +40,7 @@ public:
 	{}
 
 public:
+	using ::parser::Parser::GetState;
 	using ::parser::Parser::lexer_;
 	using ::parser::Parser::mediator_;
 };
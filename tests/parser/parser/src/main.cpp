@@ -23,6 +23,10 @@
 #include <filesystem>
 #include <future>
 
+#include "parser/states/keyword.hpp"
+#include "parser/states/keywords/project.hpp"
+#include "parser/states/statement.hpp"
+
 #include "fakes/parser/parser.hpp"
 
 namespace fs = std::filesystem;
@@ -50,7 +54,7 @@ protected:
 const fs::path ParserTest::kFilePath{""};
 
 /**
- * @brief Check if the nullptr state make the parser end file processing job
+ * @brief Check if the kNone state make the parser end file processing job
  * 
  * @note It is very important to use stubs of the Statement component for this
  *       test, because it doesn't switch the parser to any other states.
@@ -60,10 +64,26 @@ TEST_F(ParserTest, TestProcess)
 	// Run the processing method
 	const auto handle = std::async(std::launch::async, [&] { instance_.Process(); });
 
-	// Make the state switch to "nullptr"
-	instance_.mediator_.SetState({});
+	// Make the state switch to "kNone"
+	instance_.mediator_.SetState(parser::states::Type::kNone);
 
 	// Expect the processing to be stopped
 	const auto status = handle.wait_for(std::chrono::seconds(1));
 	EXPECT_EQ(status, std::future_status::ready);
+}
+
+/**
+ * @brief Check if the GetState() method returns the preallocated states
+ * 
+ */
+TEST_F(ParserTest, TestGetState)
+{
+	const auto& statement = instance_.GetState(parser::states::Type::kStatement);
+	EXPECT_TRUE(dynamic_cast<const parser::states::Statement*>(&statement));
+
+	const auto& keyword = instance_.GetState(parser::states::Type::kKeyword);
+	EXPECT_TRUE(dynamic_cast<const parser::states::Keyword*>(&keyword));
+
+	const auto& project = instance_.GetState(parser::states::Type::kProject);
+	EXPECT_TRUE(dynamic_cast<const parser::states::keywords::Project*>(&project));
 }
\ No newline at end of file
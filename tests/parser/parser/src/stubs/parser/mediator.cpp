@@ -19,24 +19,25 @@
 
 #include "parser/mediator.hpp"
 
+#include <utility>
+
 #include "parser/exceptions/existingprojectexception.hpp"
 #include "parser/exceptions/nonexistentprojectexception.hpp"
-#include "parser/states/statement.hpp"
 
 namespace parser
 {
 Mediator::Mediator()
-	: state_{std::make_unique<states::Statement>(*this)}
+	: state_{states::Type::kStatement}
 {}
 
-void Mediator::SetState(std::unique_ptr<states::State> state)
+void Mediator::SetState(states::Type state)
 {
-	state_ = std::move(state);
+	state_ = state;
 }
 
-std::unique_ptr<states::State> Mediator::GetState()
+states::Type Mediator::GetState()
 {
-	return std::move(state_);
+	return std::exchange(state_, states::Type::kNone);
 }
 
 void Mediator::SetJob(std::unique_ptr<scheduler::pipeline::Job> job)
@@ -24,12 +24,6 @@
 #include "parser/exceptions/unexpectedendoffileexception.hpp"
 #include "parser/exceptions/unexpectedkeywordexception.hpp"
 #include "parser/parser.hpp"
-#include "parser/states/keywords/deps.hpp"
-#include "parser/states/keywords/files.hpp"
-#include "parser/states/keywords/inc.hpp"
-#include "parser/states/keywords/let.hpp"
-#include "parser/states/keywords/pre.hpp"
-#include "parser/states/keywords/project.hpp"
 #include "parser/tokens/word.hpp"
 
 #include "auxillary/handlers/dummyhandler.hpp"
@@ -111,9 +105,7 @@ TEST_F(KeywordTest, TestProcessProjectKeyword)
 	fakes::lexer::Lexer lexer{kFilePath, std::move(handler)};
 
 	EXPECT_NO_THROW(instance_.Process(lexer));
-
-	EXPECT_TRUE(
-		dynamic_cast<parser::states::keywords::Project*>(instance_.mediator_.GetState().get()));
+	EXPECT_EQ(instance_.mediator_.GetState(), parser::states::Type::kProject);
 }
 
 /**
@@ -129,8 +121,7 @@ TEST_F(KeywordTest, TestProcessFilesKeyword)
 	fakes::lexer::Lexer lexer{kFilePath, std::move(handler)};
 
 	EXPECT_NO_THROW(instance_.Process(lexer));
-	EXPECT_TRUE(
-		dynamic_cast<parser::states::keywords::Files*>(instance_.mediator_.GetState().get()));
+	EXPECT_EQ(instance_.mediator_.GetState(), parser::states::Type::kFiles);
 }
 
 /**
@@ -146,8 +137,7 @@ TEST_F(KeywordTest, TestProcessDepsKeyword)
 	fakes::lexer::Lexer lexer{kFilePath, std::move(handler)};
 
 	EXPECT_NO_THROW(instance_.Process(lexer));
-	EXPECT_TRUE(
-		dynamic_cast<parser::states::keywords::Deps*>(instance_.mediator_.GetState().get()));
+	EXPECT_EQ(instance_.mediator_.GetState(), parser::states::Type::kDeps);
 }
 
 /**
@@ -163,7 +153,7 @@ TEST_F(KeywordTest, TestProcessPreKeyword)
 	fakes::lexer::Lexer lexer{kFilePath, std::move(handler)};
 
 	EXPECT_NO_THROW(instance_.Process(lexer));
-	EXPECT_TRUE(dynamic_cast<parser::states::keywords::Pre*>(instance_.mediator_.GetState().get()));
+	EXPECT_EQ(instance_.mediator_.GetState(), parser::states::Type::kPre);
 }
 
 /**
@@ -179,7 +169,7 @@ TEST_F(KeywordTest, TestProcessLetKeyword)
 	fakes::lexer::Lexer lexer{kFilePath, std::move(handler)};
 
 	EXPECT_NO_THROW(instance_.Process(lexer));
-	EXPECT_TRUE(dynamic_cast<parser::states::keywords::Let*>(instance_.mediator_.GetState().get()));
+	EXPECT_EQ(instance_.mediator_.GetState(), parser::states::Type::kLet);
 }
 
 /**
@@ -195,5 +185,37 @@ TEST_F(KeywordTest, TestProcessIncKeyword)
 	fakes::lexer::Lexer lexer{kFilePath, std::move(handler)};
 
 	EXPECT_NO_THROW(instance_.Process(lexer));
-	EXPECT_TRUE(dynamic_cast<parser::states::keywords::Inc*>(instance_.mediator_.GetState().get()));
+	EXPECT_EQ(instance_.mediator_.GetState(), parser::states::Type::kInc);
+}
+
+/**
+ * @brief Check if the Process() method correctly handles the "!isolated" keyword
+ * 
+ */
+TEST_F(KeywordTest, TestProcessIsolatedKeyword)
+{
+	std::vector<std::unique_ptr<Token>> tokens{};
+	tokens.emplace_back(std::make_unique<Word>("isolated"));
+
+	auto handler = std::make_unique<handlers::DummyHandler>(std::move(tokens));
+	fakes::lexer::Lexer lexer{kFilePath, std::move(handler)};
+
+	EXPECT_NO_THROW(instance_.Process(lexer));
+	EXPECT_EQ(instance_.mediator_.GetState(), parser::states::Type::kIsolated);
+}
+
+/**
+ * @brief Check if the Process() method correctly handles the "!pch" keyword
+ * 
+ */
+TEST_F(KeywordTest, TestProcessPchKeyword)
+{
+	std::vector<std::unique_ptr<Token>> tokens{};
+	tokens.emplace_back(std::make_unique<Word>("pch"));
+
+	auto handler = std::make_unique<handlers::DummyHandler>(std::move(tokens));
+	fakes::lexer::Lexer lexer{kFilePath, std::move(handler)};
+
+	EXPECT_NO_THROW(instance_.Process(lexer));
+	EXPECT_EQ(instance_.mediator_.GetState(), parser::states::Type::kPch);
 }
\ No newline at end of file
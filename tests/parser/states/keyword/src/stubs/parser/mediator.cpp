@@ -19,24 +19,24 @@
 
 #include "parser/mediator.hpp"
 
-#include "parser/states/statement.hpp"
+#include <utility>
 
 namespace parser
 {
 Mediator::Mediator()
-	: state_{}
+	: state_{states::Type::kNone}
 {
 	// noop
 }
 
-void Mediator::SetState(std::unique_ptr<states::State> state)
+void Mediator::SetState(states::Type state)
 {
-	state_ = std::move(state);
+	state_ = state;
 }
 
-std::unique_ptr<states::State> Mediator::GetState()
+states::Type Mediator::GetState()
 {
-	return std::move(state_);
+	return std::exchange(state_, states::Type::kNone);
 }
 
 void Mediator::SetJob(std::unique_ptr<scheduler::pipeline::Job> job)
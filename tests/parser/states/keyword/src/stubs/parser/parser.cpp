@@ -19,8 +19,6 @@
 
 #include "parser/parser.hpp"
 
-#include "parser/states/statement.hpp"
-
 namespace parser
 {
 Parser::Parser(const std::filesystem::path& path)
@@ -36,4 +34,9 @@ scheduler::pipeline::Job Parser::Process()
 {
 	return scheduler::pipeline::Job{""};
 }
+
+states::State& Parser::GetState(states::Type type)
+{
+	return *states_[static_cast<std::size_t>(type)];
+}
 } // namespace parser
\ No newline at end of file
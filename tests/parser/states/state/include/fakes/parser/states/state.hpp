@@ -51,6 +51,7 @@ public:
 	}
 
 public:
+	using ::parser::states::State::Is;
 	using ::parser::states::State::Match;
 	using ::parser::states::State::mediator_;
 };
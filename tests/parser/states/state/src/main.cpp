@@ -21,7 +21,7 @@
 
 #include "parser/exceptions/unexpectedtokenexception.hpp"
 #include "parser/parser.hpp"
-#include "parser/tokens/word.hpp"
+#include "parser/tokens/lexeme.hpp"
 
 #include "fakes/parser/states/state.hpp"
 
@@ -66,7 +66,55 @@ TEST_F(StateTest, TestMatchNotPunctuator)
 	using Punctuator = parser::tokens::Punctuator;
 	using Type = Punctuator::Type;
 
-	auto token = std::make_unique<parser::tokens::Word>("");
-	EXPECT_THROW(instance_.Match(token.get(), Type::kDoubleQuoteMark),
+	const parser::tokens::Lexeme token{parser::tokens::Lexeme::Kind::kWord};
+	EXPECT_THROW(instance_.Match(&token, Type::kDoubleQuoteMark),
 				 parser::exceptions::UnexpectedTokenException);
+}
+
+/**
+ * @brief Check if the Match() method correctly handles punctuators of other types
+ * 
+ */
+TEST_F(StateTest, TestMatchOtherPunctuator)
+{
+	using Lexeme = parser::tokens::Lexeme;
+	using Type = parser::tokens::Punctuator::Type;
+
+	const Lexeme token{Lexeme::Kind::kPunctuator, static_cast<uint8_t>(Type::kComma)};
+	EXPECT_THROW(instance_.Match(&token, Type::kDoubleQuoteMark),
+				 parser::exceptions::UnexpectedTokenException);
+}
+
+/**
+ * @brief Check if the Match() method accepts the expected punctuator
+ * 
+ */
+TEST_F(StateTest, TestMatch)
+{
+	using Lexeme = parser::tokens::Lexeme;
+	using Type = parser::tokens::Punctuator::Type;
+
+	const Lexeme token{Lexeme::Kind::kPunctuator, static_cast<uint8_t>(Type::kDoubleQuoteMark)};
+	EXPECT_NO_THROW(instance_.Match(&token, Type::kDoubleQuoteMark));
+}
+
+/**
+ * @brief Check if the Is() methods tell tokens apart without throwing
+ * 
+ */
+TEST_F(StateTest, TestIs)
+{
+	using Lexeme = parser::tokens::Lexeme;
+	using Operator = parser::tokens::Operator;
+	using Punctuator = parser::tokens::Punctuator;
+
+	const Lexeme comma{Lexeme::Kind::kPunctuator, static_cast<uint8_t>(Punctuator::Type::kComma)};
+	const Lexeme dollar{Lexeme::Kind::kOperator, static_cast<uint8_t>(Operator::Type::kDollarSign)};
+
+	EXPECT_TRUE(instance_.Is(&comma, Punctuator::Type::kComma));
+	EXPECT_FALSE(instance_.Is(&comma, Punctuator::Type::kDot));
+	EXPECT_FALSE(instance_.Is(&dollar, Punctuator::Type::kComma));
+	EXPECT_TRUE(instance_.Is(&dollar, Operator::Type::kDollarSign));
+	EXPECT_FALSE(instance_.Is(&comma, Operator::Type::kDollarSign));
+	EXPECT_FALSE(instance_.Is(nullptr, Punctuator::Type::kComma));
 }
\ No newline at end of file
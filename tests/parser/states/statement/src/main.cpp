@@ -23,7 +23,6 @@
 
 #include "parser/exceptions/unexpectedtokenexception.hpp"
 #include "parser/parser.hpp"
-#include "parser/states/keyword.hpp"
 #include "parser/tokens/word.hpp"
 
 #include "auxillary/handlers/dummyhandler.hpp"
@@ -108,5 +107,5 @@ TEST_F(StatementTest, TestProcessProjectKeyword)
 	fakes::lexer::Lexer lexer{kFilePath, std::move(handler)};
 
 	EXPECT_NO_THROW(instance_.Process(lexer));
-	EXPECT_TRUE(dynamic_cast<parser::states::Keyword*>(instance_.mediator_.GetState().get()));
+	EXPECT_EQ(instance_.mediator_.GetState(), parser::states::Type::kKeyword);
 }
\ No newline at end of file
@@ -25,14 +25,20 @@ Lexer::Lexer(const std::filesystem::path& path)
 	: scanner_{path}
 {}
 
-std::shared_ptr<Lexer::Token> Lexer::Next()
+const Lexer::Lexeme* Lexer::Next()
 {
-	token_ = std::move(handler_->Process(scanner_));
-	return token_;
+	extension_ = handler_->Process(scanner_);
+	token_.reset();
+	if(extension_)
+	{
+		token_ = extension_->ToLexeme();
+	}
+
+	return Get();
 }
 
-std::shared_ptr<Lexer::Token> Lexer::Get() const
+const Lexer::Lexeme* Lexer::Get() const
 {
-	return token_;
+	return token_ ? &token_.value() : nullptr;
 }
 } // namespace lexer
\ No newline at end of file
@@ -34,28 +34,24 @@ void String::Process(lexer::Lexer& lexer)
 	auto token = State::SkipSeparators(lexer);
 
 	// Expect the double quote mark at the start of the string
-	Match(token.get(), ::parser::tokens::Punctuator::Type::kDoubleQuoteMark);
+	Match(token, ::parser::tokens::Punctuator::Type::kDoubleQuoteMark);
 
 	// Add tokens one by one to the internal buffer
 	while((token = lexer.Next()))
 	{
-		const auto value = std::move(token->GetValue());
-		try
+		if(Is(token, tokens::Punctuator::Type::kDoubleQuoteMark))
 		{
-			Match(token.get(), tokens::Punctuator::Type::kDoubleQuoteMark);
 			return;
 		}
-		catch(const exceptions::UnexpectedTokenException& e)
-		{
-			// Add the token to the whole value
-			value_ += value;
-		}
+
+		// Add the token to the whole value
+		value_ += token->value;
 	}
 
 	throw exceptions::UnexpectedTokenException("");
 }
 
-std::string String::GetValue() const
+const std::string& String::GetValue() const
 {
 	return value_;
 }
@@ -0,0 +1,204 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "parser/exceptions/unexpectedtokenexception.hpp"
+#include "parser/parser.hpp"
+#include "parser/states/types/commands.hpp"
+#include "parser/tokens/word.hpp"
+
+#include "auxillary/handlers/dummyhandler.hpp"
+#include "fakes/lexer/lexer.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief The default file path, used by the test suite
+ * 
+ */
+const fs::path kFilePath{""};
+
+/**
+ * @brief A text fixture to test parser::states::types::Commands component
+ * 
+ */
+class CommandsTest : public ::testing::Test
+{
+protected:
+	using Token      = parser::tokens::Token;
+	using Punctuator = parser::tokens::Punctuator;
+	using Word       = parser::tokens::Word;
+
+protected:
+	/**
+	 * @brief Add the tokens of the string with the given value
+	 * 
+	 * @param tokens - the tokens to add to
+	 * @param value - the value of the string
+	 */
+	static void AddString(std::vector<std::unique_ptr<Token>>& tokens, const std::string& value)
+	{
+		tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kDoubleQuoteMark));
+		tokens.emplace_back(std::make_unique<Word>(value));
+		tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kDoubleQuoteMark));
+	}
+
+	/**
+	 * @brief Process the given tokens
+	 * 
+	 * @param tokens - the tokens to process
+	 */
+	void Process(std::vector<std::unique_ptr<Token>> tokens)
+	{
+		auto handler = std::make_unique<handlers::DummyHandler>(std::move(tokens));
+		fakes::lexer::Lexer lexer{kFilePath, std::move(handler)};
+		instance_.Process(lexer);
+	}
+
+protected:
+	/**
+	 * @brief An instance of parser
+	 * 
+	 */
+	parser::Parser parser_{kFilePath};
+
+	/**
+	 * @brief An instance of mediator
+	 * 
+	 */
+	parser::Mediator mediator_;
+
+	/**
+	 * @brief The instance to test
+	 * 
+	 */
+	parser::states::types::Commands instance_{mediator_};
+};
+
+/**
+ * @brief Check if the Process() method correctly processes the commands without any files
+ * 
+ */
+TEST_F(CommandsTest, TestProcess)
+{
+	std::vector<std::unique_ptr<Token>> tokens;
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kLeftSquareBracket));
+	AddString(tokens, "first");
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kComma));
+	AddString(tokens, "second");
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kRightSquareBracket));
+
+	ASSERT_NO_THROW(Process(std::move(tokens)));
+
+	const auto& commands = instance_.GetCommands();
+	ASSERT_EQ(commands.size(), 2);
+	EXPECT_EQ(commands.at(0).line, "first");
+	EXPECT_TRUE(commands.at(0).inputs.empty());
+	EXPECT_TRUE(commands.at(0).outputs.empty());
+	EXPECT_EQ(commands.at(1).line, "second");
+}
+
+/**
+ * @brief Check if the Process() method correctly processes the inputs and the outputs of the commands
+ * 
+ */
+TEST_F(CommandsTest, TestProcessFiles)
+{
+	std::vector<std::unique_ptr<Token>> tokens;
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kLeftSquareBracket));
+	AddString(tokens, "generate");
+	tokens.emplace_back(std::make_unique<Word>("in"));
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kLeftSquareBracket));
+	AddString(tokens, "schema");
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kRightSquareBracket));
+	tokens.emplace_back(std::make_unique<Word>("out"));
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kLeftSquareBracket));
+	AddString(tokens, "source");
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kComma));
+	AddString(tokens, "header");
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kRightSquareBracket));
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kComma));
+	AddString(tokens, "pack");
+	tokens.emplace_back(std::make_unique<Word>("out"));
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kLeftSquareBracket));
+	AddString(tokens, "archive");
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kRightSquareBracket));
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kRightSquareBracket));
+
+	ASSERT_NO_THROW(Process(std::move(tokens)));
+
+	const auto& commands = instance_.GetCommands();
+	ASSERT_EQ(commands.size(), 2);
+	EXPECT_EQ(commands.at(0).inputs, std::vector<fs::path>{"schema"});
+	EXPECT_EQ(commands.at(0).outputs, (std::vector<fs::path>{"source", "header"}));
+	EXPECT_TRUE(commands.at(1).inputs.empty());
+	EXPECT_EQ(commands.at(1).outputs, std::vector<fs::path>{"archive"});
+}
+
+/**
+ * @brief Check if the Process() method correctly processes the serial marker, after the files or without them
+ * 
+ */
+TEST_F(CommandsTest, TestProcessSerial)
+{
+	std::vector<std::unique_ptr<Token>> tokens;
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kLeftSquareBracket));
+	AddString(tokens, "generate");
+	tokens.emplace_back(std::make_unique<Word>("out"));
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kLeftSquareBracket));
+	AddString(tokens, "source");
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kRightSquareBracket));
+	tokens.emplace_back(std::make_unique<Word>("serial"));
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kComma));
+	AddString(tokens, "clean");
+	tokens.emplace_back(std::make_unique<Word>("serial"));
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kComma));
+	AddString(tokens, "pack");
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kRightSquareBracket));
+
+	ASSERT_NO_THROW(Process(std::move(tokens)));
+
+	const auto& commands = instance_.GetCommands();
+	ASSERT_EQ(commands.size(), 3);
+	EXPECT_TRUE(commands.at(0).serial);
+	EXPECT_EQ(commands.at(0).outputs, std::vector<fs::path>{"source"});
+	EXPECT_TRUE(commands.at(1).serial);
+	EXPECT_FALSE(commands.at(2).serial);
+}
+
+/**
+ * @brief Check if the Process() method rejects the outputs, declared before the inputs
+ * 
+ */
+TEST_F(CommandsTest, TestProcessFilesOrder)
+{
+	std::vector<std::unique_ptr<Token>> tokens;
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kLeftSquareBracket));
+	AddString(tokens, "generate");
+	tokens.emplace_back(std::make_unique<Word>("out"));
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kLeftSquareBracket));
+	AddString(tokens, "source");
+	tokens.emplace_back(std::make_unique<Punctuator>(Punctuator::Type::kRightSquareBracket));
+	tokens.emplace_back(std::make_unique<Word>("in"));
+
+	EXPECT_THROW(Process(std::move(tokens)), parser::exceptions::UnexpectedTokenException);
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "parser/states/state.hpp"
+
+#include "parser/exceptions/unexpectedtokenexception.hpp"
+#include "parser/mediator.hpp"
+
+namespace parser::states
+{
+State::State(Mediator& mediator)
+	: mediator_{mediator}
+{}
+
+const tokens::Lexeme* State::SkipSeparators(lexer::Lexer& lexer)
+{
+	const tokens::Lexeme* token;
+	while((token = lexer.Next()))
+	{
+		if(token->kind != tokens::Lexeme::Kind::kSeparator)
+		{
+			break;
+		}
+	}
+
+	return token;
+}
+
+void State::Match(const tokens::Lexeme* token, tokens::Punctuator::Type value)
+{
+	if(!token)
+	{
+		// FIXME: replace with the UnexpectedEndOfFile exception
+		throw exceptions::UnexpectedTokenException("EOF");
+	}
+
+	if(!Is(token, value))
+	{
+		throw exceptions::UnexpectedTokenException(std::string{token->value});
+	}
+}
+
+bool State::Is(const tokens::Lexeme* token, tokens::Punctuator::Type value)
+{
+	return token && token->kind == tokens::Lexeme::Kind::kPunctuator &&
+		   token->subtype == static_cast<uint8_t>(value);
+}
+
+bool State::Is(const tokens::Lexeme* token, tokens::Operator::Type value)
+{
+	return token && token->kind == tokens::Lexeme::Kind::kOperator &&
+		   token->subtype == static_cast<uint8_t>(value);
+}
+} // namespace parser::states
\ No newline at end of file
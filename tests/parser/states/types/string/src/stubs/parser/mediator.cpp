@@ -22,22 +22,21 @@
 #include "parser/exceptions/existingprojectexception.hpp"
 #include "parser/exceptions/nonexistentprojectexception.hpp"
 #include "parser/exceptions/undeclaredvariableexception.hpp"
-#include "parser/states/statement.hpp"
 
 namespace parser
 {
 Mediator::Mediator()
-	: state_{std::make_unique<states::Statement>(*this)}
+	: state_{states::Type::kStatement}
 {}
 
-void Mediator::SetState(std::unique_ptr<states::State> state)
+void Mediator::SetState(states::Type state)
 {
 	// noop
 }
 
-std::unique_ptr<states::State> Mediator::GetState()
+states::Type Mediator::GetState()
 {
-	return {};
+	return states::Type::kNone;
 }
 
 void Mediator::SetJob(std::unique_ptr<scheduler::pipeline::Job> job)
@@ -55,18 +54,19 @@ scheduler::pipeline::Job Mediator::GetJob()
 	return std::move(*job_);
 }
 
-void Mediator::DeclareVariable(std::string id, std::string value)
+void Mediator::DeclareVariable(std::string_view id, std::string_view value)
 {
-	variables_.insert({id, value});
+	variables_.Insert(id, value);
 }
 
-std::string Mediator::GetVariableValue(std::string id) const
+std::string_view Mediator::GetVariableValue(std::string_view id) const
 {
-	if(variables_.find(id) == variables_.end())
+	const auto value = variables_.Find(id);
+	if(!value)
 	{
-		throw exceptions::UndeclaredVariableException(std::move(id));
+		throw exceptions::UndeclaredVariableException(std::string{id});
 	}
 
-	return variables_.at(id);
+	return *value;
 }
 } // namespace parser
\ No newline at end of file
@@ -21,7 +21,6 @@
 
 #include "parser/exceptions/unexpectedendoffileexception.hpp"
 #include "parser/exceptions/unexpectedtokenexception.hpp"
-#include "parser/tokens/word.hpp"
 
 namespace parser::states
 {
@@ -39,22 +38,21 @@ void Variable::Process(lexer::Lexer& lexer)
 	}
 
 	// Check if the ID is a word
-	auto ptr = dynamic_cast<tokens::Word*>(token.get());
-	if(!ptr)
+	if(token->kind != tokens::Lexeme::Kind::kWord)
 	{
-		throw exceptions::UnexpectedTokenException(token->GetValue());
+		throw exceptions::UnexpectedTokenException(std::string{token->value});
 	}
 
-	value_ = mediator_.GetVariableValue(token->GetValue());
+	value_ = mediator_.GetVariableValue(token->value);
 }
 
-std::string Variable::GetValue() const
+std::string_view Variable::GetValue() const
 {
 	return value_;
 }
 
 void Variable::Clear()
 {
-	value_.clear();
+	value_ = {};
 }
 } // namespace parser::states
\ No newline at end of file
@@ -37,4 +37,9 @@ std::string Separator::GetValue() const
 									   [&](const auto& pair) { return pair.second == type; });
 	return std::string(iterator->first, 1);
 }
+
+Lexeme Separator::ToLexeme() const
+{
+	return {Lexeme::Kind::kSeparator, static_cast<uint8_t>(type), {}};
+}
 } // namespace parser::tokens
\ No newline at end of file
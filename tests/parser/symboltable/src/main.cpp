@@ -0,0 +1,97 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "parser/symboltable.hpp"
+
+/**
+ * @brief A text fixture to test parser::SymbolTable component
+ * 
+ */
+class SymbolTableTest : public ::testing::Test
+{
+protected:
+	/**
+	 * @brief The instance to test
+	 * 
+	 */
+	parser::SymbolTable instance_{};
+};
+
+/**
+ * @brief Check if the inserted symbol can be found
+ * 
+ */
+TEST_F(SymbolTableTest, TestFind)
+{
+	EXPECT_TRUE(instance_.Insert("root", "/usr/src"));
+	EXPECT_EQ(instance_.Find("root"), "/usr/src");
+	EXPECT_EQ(instance_.GetSize(), 1);
+}
+
+/**
+ * @brief Check if nothing is found for an unknown name
+ * 
+ */
+TEST_F(SymbolTableTest, TestFindUnknown)
+{
+	EXPECT_FALSE(instance_.Find("root"));
+
+	instance_.Insert("root", "/usr/src");
+	EXPECT_FALSE(instance_.Find("roo"));
+}
+
+/**
+ * @brief Check if the existing symbol is kept when the name is inserted again
+ * 
+ */
+TEST_F(SymbolTableTest, TestInsertExisting)
+{
+	instance_.Insert("root", "/usr/src");
+
+	EXPECT_FALSE(instance_.Insert("root", "/tmp"));
+	EXPECT_EQ(instance_.Find("root"), "/usr/src");
+	EXPECT_EQ(instance_.GetSize(), 1);
+}
+
+/**
+ * @brief Check if the symbols are copied and stay valid while the table grows
+ * 
+ */
+TEST_F(SymbolTableTest, TestGrow)
+{
+	constexpr std::size_t kCount = 1000;
+	for(std::size_t i = 0; i < kCount; ++i)
+	{
+		const auto name = "v" + std::to_string(i);
+		instance_.Insert(name, std::to_string(i));
+	}
+
+	const auto first = instance_.Find("v0");
+	for(std::size_t i = 0; i < kCount; ++i)
+	{
+		EXPECT_EQ(instance_.Find("v" + std::to_string(i)), std::to_string(i));
+	}
+
+	EXPECT_EQ(instance_.Find("v0")->data(), first->data());
+	EXPECT_EQ(instance_.GetSize(), kCount);
+}
\ No newline at end of file
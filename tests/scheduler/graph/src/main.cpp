@@ -0,0 +1,125 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "scheduler/graph.hpp"
+#include "scheduler/threadpool.hpp"
+
+/**
+ * @brief Check if the Add() method numbers the nodes in the order of addition
+ * 
+ */
+TEST(GraphTest, TestAdd)
+{
+	scheduler::Graph graph{};
+	EXPECT_EQ(graph.Add([] {}), 0);
+	EXPECT_EQ(graph.Add([] {}), 1);
+	EXPECT_EQ(graph.GetSize(), 2);
+}
+
+/**
+ * @brief Check if every node is run after the nodes it depends on
+ * 
+ */
+TEST(GraphTest, TestRunOrder)
+{
+	std::mutex mutex{};
+	std::vector<int> order{};
+	const auto task = [&mutex, &order](int value) {
+		return [&mutex, &order, value] {
+			std::unique_lock<std::mutex> lock{mutex};
+			order.push_back(value);
+		};
+	};
+
+	// A diamond: the first node goes before both of the middle ones, the last one goes after them
+	scheduler::Graph graph{};
+	const auto last  = graph.Add(task(3));
+	const auto left  = graph.Add(task(1));
+	const auto right = graph.Add(task(2));
+	const auto first = graph.Add(task(0));
+	graph.AddDependency(left, first);
+	graph.AddDependency(right, first);
+	graph.AddDependency(last, left);
+	graph.AddDependency(last, right);
+
+	scheduler::ThreadPool pool{4};
+	graph.Run(pool);
+	pool.Wait();
+
+	ASSERT_EQ(order.size(), 4);
+	EXPECT_EQ(order.front(), 0);
+	EXPECT_EQ(order.back(), 3);
+}
+
+/**
+ * @brief Check if the independent nodes are run concurrently
+ * 
+ */
+TEST(GraphTest, TestRunConcurrently)
+{
+	constexpr int kNodes = 4;
+	std::atomic<int> started{0};
+
+	// Every node waits for the rest of them to start, so it can only finish if they run at the same time
+	scheduler::Graph graph{};
+	for(int i = 0; i < kNodes; ++i)
+	{
+		graph.Add([&started] {
+			++started;
+			while(started < kNodes)
+			{
+				std::this_thread::yield();
+			}
+		});
+	}
+
+	scheduler::ThreadPool pool{kNodes};
+	graph.Run(pool);
+	pool.Wait();
+
+	EXPECT_EQ(started, kNodes);
+}
+
+/**
+ * @brief Check if the nodes, that depend on a failed node, are never run
+ * 
+ */
+TEST(GraphTest, TestRunException)
+{
+	std::atomic<bool> run{false};
+
+	scheduler::Graph graph{};
+	const auto failed    = graph.Add([] { throw std::runtime_error("error"); });
+	const auto dependent = graph.Add([&run] { run = true; });
+	graph.AddDependency(dependent, failed);
+
+	scheduler::ThreadPool pool{2};
+	graph.Run(pool);
+
+	EXPECT_THROW(pool.Wait(), std::runtime_error);
+	EXPECT_FALSE(run);
+}
\ No newline at end of file
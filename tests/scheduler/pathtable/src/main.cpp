@@ -0,0 +1,115 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "scheduler/pathtable.hpp"
+
+using scheduler::PathTable;
+
+/**
+ * @brief Check if the same path always gets the same ID
+ * 
+ */
+TEST(PathTableTest, TestIntern)
+{
+	auto& table = PathTable::GetInstance();
+	const auto first  = table.Intern("src/main.cpp");
+	const auto second = table.Intern("src/util.cpp");
+
+	EXPECT_NE(first, second);
+	EXPECT_EQ(table.Intern("src/main.cpp"), first);
+	EXPECT_EQ(table.GetPath(first), "src/main.cpp");
+	EXPECT_EQ(table.GetPath(second), "src/util.cpp");
+}
+
+/**
+ * @brief Check if the threads, interning the same paths, get the same IDs
+ * 
+ */
+TEST(PathTableTest, TestInternConcurrent)
+{
+	auto& table      = PathTable::GetInstance();
+	const auto size  = table.GetSize();
+	const auto count = 1000;
+
+	std::vector<std::vector<PathTable::Id>> ids(4);
+	std::vector<std::thread> threads{};
+	for(auto& result : ids)
+	{
+		threads.emplace_back([&table, &result] {
+			for(int index = 0; index < count; ++index)
+			{
+				result.push_back(table.Intern("file" + std::to_string(index) + ".hpp"));
+			}
+		});
+	}
+
+	for(auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	EXPECT_EQ(table.GetSize(), size + count);
+	for(const auto& result : ids)
+	{
+		EXPECT_EQ(result, ids.front());
+	}
+}
+
+/**
+ * @brief Check if the object file name replaces the extension of the file name
+ * 
+ */
+TEST(PathTableTest, TestGetObjectName)
+{
+	auto& table = PathTable::GetInstance();
+	const auto id = table.Intern("project/src/main.cpp");
+
+	EXPECT_EQ(table.GetObjectName(id), "main.o");
+	EXPECT_EQ(&table.GetObjectName(id), &table.GetObjectName(id));
+}
+
+/**
+ * @brief Check if the modification time is only read again after a reset
+ * 
+ */
+TEST(PathTableTest, TestGetWriteTime)
+{
+	const std::filesystem::path file{"pathtable.txt"};
+	std::ofstream{file}.close();
+
+	auto& table     = PathTable::GetInstance();
+	const auto id   = table.Intern(file);
+	const auto time = table.GetWriteTime(id);
+
+	const auto later = time + std::chrono::seconds{10};
+	std::filesystem::last_write_time(file, later);
+	EXPECT_EQ(table.GetWriteTime(id), time);
+
+	table.ResetWriteTimes();
+	EXPECT_EQ(table.GetWriteTime(id), later);
+
+	std::filesystem::remove(file);
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "scheduler/pipeline/includes.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief A text fixture to test scheduler::pipeline::Includes component
+ * 
+ */
+class IncludesTest : public ::testing::Test
+{
+protected:
+	/**
+	 * @brief Create the headers to count
+	 * 
+	 */
+	void SetUp() override
+	{
+		fs::create_directories(kDirectory);
+		for(const auto& header : {kCommon, kRare, kSmall})
+		{
+			std::ofstream{header}.close();
+		}
+	}
+
+	/**
+	 * @brief Remove the headers and the generated files
+	 * 
+	 */
+	void TearDown() override
+	{
+		fs::remove_all(kDirectory);
+	}
+
+	/**
+	 * @brief Read the generated header
+	 * 
+	 * @return std::string - the contents of the header, empty if it doesn't exist
+	 */
+	std::string ReadHeader() const
+	{
+		std::ifstream stream{instance_.GetHeader()};
+		return {std::istreambuf_iterator<char>{stream}, {}};
+	}
+
+	/**
+	 * @brief Weigh the headers, counting the calls
+	 * 
+	 * @param header - the header to weigh
+	 * @return std::size_t - a huge size for every header, except the small one
+	 */
+	std::size_t Weigh(const fs::path& header)
+	{
+		++weighed_;
+		return header == kSmall ? 1 : 1024 * 1024;
+	}
+
+protected:
+	/**
+	 * @brief The directory, used by the test suite
+	 * 
+	 */
+	static const fs::path kDirectory;
+
+	/**
+	 * @brief The header, included by every file
+	 * 
+	 */
+	static const fs::path kCommon;
+
+	/**
+	 * @brief The header, included by a single file
+	 * 
+	 */
+	static const fs::path kRare;
+
+	/**
+	 * @brief The header, included by every file, but too small to precompile
+	 * 
+	 */
+	static const fs::path kSmall;
+
+	/**
+	 * @brief The number of the weighed headers
+	 * 
+	 */
+	std::size_t weighed_{0};
+
+	/**
+	 * @brief The instance to test
+	 * 
+	 */
+	scheduler::pipeline::Includes instance_{kDirectory / "pch"};
+};
+
+const fs::path IncludesTest::kDirectory{"headers"};
+const fs::path IncludesTest::kCommon{kDirectory / "common.hpp"};
+const fs::path IncludesTest::kRare{kDirectory / "rare.hpp"};
+const fs::path IncludesTest::kSmall{kDirectory / "small.h"};
+
+/**
+ * @brief Check if the Update() method selects the heavy headers, included by every file
+ * 
+ */
+TEST_F(IncludesTest, TestUpdate)
+{
+	instance_.Add({kCommon, kSmall, kRare, kDirectory / "table.inc"});
+	instance_.Add({kCommon, kSmall});
+	instance_.Add({kCommon, kSmall});
+
+	const auto weigh = [this](const fs::path& header) { return Weigh(header); };
+	ASSERT_TRUE(instance_.Update(3, weigh));
+	EXPECT_EQ(weighed_, 2);
+
+	const auto header = ReadHeader();
+	EXPECT_NE(header.find(fs::absolute(kCommon).lexically_normal().string()), std::string::npos);
+	EXPECT_EQ(header.find(kRare.filename().string()), std::string::npos);
+	EXPECT_EQ(header.find(kSmall.filename().string()), std::string::npos);
+	EXPECT_EQ(header.find("table.inc"), std::string::npos);
+}
+
+/**
+ * @brief Check if the Update() method keeps the header and reuses the sizes, if the selection is the same
+ * 
+ */
+TEST_F(IncludesTest, TestUpdateUnchanged)
+{
+	const auto weigh = [this](const fs::path& header) { return Weigh(header); };
+	instance_.Add({kCommon});
+	ASSERT_TRUE(instance_.Update(1, weigh));
+
+	scheduler::pipeline::Includes other{kDirectory / "pch"};
+	other.Add({kCommon});
+	EXPECT_FALSE(other.Update(1, weigh));
+	EXPECT_EQ(weighed_, 1);
+}
+
+/**
+ * @brief Check if the Update() method keeps the selection, if some of the files weren't counted
+ * 
+ */
+TEST_F(IncludesTest, TestUpdateTooFewFiles)
+{
+	instance_.Add({kCommon});
+
+	const auto weigh = [this](const fs::path& header) { return Weigh(header); };
+	EXPECT_FALSE(instance_.Update(4, weigh));
+	EXPECT_EQ(weighed_, 0);
+	EXPECT_FALSE(fs::exists(instance_.GetHeader()));
+}
+
+/**
+ * @brief Check if the Update() method skips the headers, that aren't included by every file
+ * 
+ */
+TEST_F(IncludesTest, TestUpdateNotEveryFile)
+{
+	instance_.Add({kCommon, kRare});
+	instance_.Add({kCommon, kRare});
+	instance_.Add({kCommon});
+
+	const auto weigh = [this](const fs::path& header) { return Weigh(header); };
+	ASSERT_TRUE(instance_.Update(3, weigh));
+
+	const auto header = ReadHeader();
+	EXPECT_NE(header.find(kCommon.filename().string()), std::string::npos);
+	EXPECT_EQ(header.find(kRare.filename().string()), std::string::npos);
+}
+
+/**
+ * @brief Check if the Update() method removes the header, if nothing is worth precompiling
+ * 
+ */
+TEST_F(IncludesTest, TestUpdateNothingSelected)
+{
+	const auto weigh = [this](const fs::path& header) { return Weigh(header); };
+	instance_.Add({kCommon});
+	ASSERT_TRUE(instance_.Update(1, weigh));
+
+	scheduler::pipeline::Includes other{kDirectory / "pch"};
+	other.Add({kSmall});
+	EXPECT_TRUE(other.Update(1, weigh));
+	EXPECT_FALSE(fs::exists(instance_.GetHeader()));
+}
\ No newline at end of file
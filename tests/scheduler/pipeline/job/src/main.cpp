@@ -60,6 +60,37 @@ TEST_F(JobTest, TestAddFile)
 	EXPECT_EQ(files.at(0), file);
 }
 
+/**
+ * @brief Check if the ReserveFiles() method keeps the files added afterwards in place
+ * 
+ */
+TEST_F(JobTest, TestReserveFiles)
+{
+	instance_.ReserveFiles(2);
+	instance_.AddFile("first.cpp");
+
+	const auto* data = instance_.GetFiles().data();
+	instance_.AddFile("second.cpp");
+
+	EXPECT_EQ(instance_.GetFiles().data(), data);
+	EXPECT_EQ(instance_.GetFiles().size(), 2);
+}
+
+/**
+ * @brief Check if the SetFiles() method replaces the files
+ * 
+ */
+TEST_F(JobTest, TestSetFiles)
+{
+	instance_.AddFile("old.cpp");
+	instance_.SetFiles({"first.cpp", "second.cpp"});
+
+	const auto& files = instance_.GetFiles();
+	ASSERT_EQ(files.size(), 2);
+	EXPECT_EQ(files.at(0), "first.cpp");
+	EXPECT_EQ(files.at(1), "second.cpp");
+}
+
 /**
  * @brief Check if the SetCompilationFlags() method correctly sets the flags
  * 
@@ -72,6 +103,34 @@ TEST_F(JobTest, TestSetCompilationFlags)
 	EXPECT_EQ(instance_.GetCompilationFlags(), flags);
 }
 
+/**
+ * @brief Check if the SetPrecompiledHeader() method correctly sets the header
+ * 
+ */
+TEST_F(JobTest, TestSetPrecompiledHeader)
+{
+	EXPECT_TRUE(instance_.GetPrecompiledHeader().empty());
+
+	const std::filesystem::path header{"common.hpp"};
+	instance_.SetPrecompiledHeader(header);
+
+	EXPECT_EQ(instance_.GetPrecompiledHeader(), header);
+}
+
+/**
+ * @brief Check if the GetIsolatedFiles() method returns a reference to the correctly filled vector
+ * 
+ */
+TEST_F(JobTest, TestAddIsolatedFile)
+{
+	const std::filesystem::path path{"legacy.cpp"};
+	instance_.AddIsolatedFile(path);
+
+	const auto& files = instance_.GetIsolatedFiles();
+	ASSERT_EQ(files.size(), 1);
+	EXPECT_EQ(files.front(), path);
+}
+
 /**
  * @brief Check if the GetDependencies() method returns a reference to the correctly filled vector
  * 
@@ -104,7 +163,7 @@ TEST_F(JobTest, TestSetProjectPath)
  */
 TEST_F(JobTest, TestSetPreCompilationCommands)
 {
-	const std::vector<std::string> commands{"some_command"};
+	const std::vector<scheduler::pipeline::Job::Command> commands{{"some_command", {"input"}, {"output"}}};
 	instance_.SetPreCompilationCommands(commands);
 
 	EXPECT_EQ(instance_.GetPreCompilationCommands(), commands);
@@ -116,7 +175,7 @@ TEST_F(JobTest, TestSetPreCompilationCommands)
  */
 TEST_F(JobTest, TestSetPostCompilationCommands)
 {
-	const std::vector<std::string> commands{"some_command"};
+	const std::vector<scheduler::pipeline::Job::Command> commands{{"some_command", {"input"}, {"output"}}};
 	instance_.SetPostCompilationCommands(commands);
 
 	EXPECT_EQ(instance_.GetPostCompilationCommands(), commands);
@@ -0,0 +1,170 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "scheduler/pipeline/modules.hpp"
+
+namespace fs = std::filesystem;
+
+using Modules = scheduler::pipeline::Modules;
+
+/**
+ * @brief Check if the Parse() method finds the module, provided by the interface, and it's imports
+ * 
+ */
+TEST(ModulesTest, TestParseInterface)
+{
+	const auto unit = Modules::Parse("module;\n"
+									 "#include <string>\n"
+									 "export module greet;\n"
+									 "export import :name;\n"
+									 "import util.strings;\n"
+									 "export std::string Greet();\n");
+
+	EXPECT_TRUE(unit.module);
+	EXPECT_EQ(unit.provides, "greet");
+	EXPECT_EQ(unit.imports, (std::vector<std::string>{"greet:name", "util.strings"}));
+}
+
+/**
+ * @brief Check if the Parse() method treats the partitions as the modules of their own
+ * 
+ */
+TEST(ModulesTest, TestParsePartition)
+{
+	const auto unit = Modules::Parse("module greet : detail;\nimport :name;\n");
+
+	EXPECT_TRUE(unit.module);
+	EXPECT_EQ(unit.provides, "greet:detail");
+	EXPECT_EQ(unit.imports, (std::vector<std::string>{"greet:name"}));
+}
+
+/**
+ * @brief Check if the Parse() method makes the implementation unit import it's interface
+ * 
+ */
+TEST(ModulesTest, TestParseImplementation)
+{
+	const auto unit = Modules::Parse("module greet;\n\nmodule :private;\n");
+
+	EXPECT_TRUE(unit.module);
+	EXPECT_TRUE(unit.provides.empty());
+	EXPECT_EQ(unit.imports, (std::vector<std::string>{"greet"}));
+}
+
+/**
+ * @brief Check if the Parse() method ignores the comments, the literals, the header units and the identifiers
+ * 
+ */
+TEST(ModulesTest, TestParseIgnored)
+{
+	const auto unit = Modules::Parse("#include <iostream>\n"
+									 "// import commented;\n"
+									 "/* import\n"
+									 "import commented; */\n"
+									 "const char* text = \"/*\";\n"
+									 "import <vector>;\n"
+									 "import \"local.hpp\";\n"
+									 "import(value);\n"
+									 "module = 1;\n"
+									 "  import greet; // the greeting\n");
+
+	EXPECT_FALSE(unit.module);
+	EXPECT_TRUE(unit.provides.empty());
+	EXPECT_EQ(unit.imports, (std::vector<std::string>{"greet"}));
+}
+
+/**
+ * @brief Check if the Scan() method reads the file, and finds nothing, if there's no file
+ * 
+ */
+TEST(ModulesTest, TestScan)
+{
+	const fs::path directory{"sources"};
+	fs::create_directories(directory);
+	std::ofstream{directory / "greet.cpp"} << "export module greet;\n";
+
+	EXPECT_EQ(Modules::Scan(directory / "greet.cpp").provides, "greet");
+	EXPECT_TRUE(Modules::Scan(directory / "missing.cpp").provides.empty());
+
+	fs::remove_all(directory);
+}
+
+/**
+ * @brief Check if the Find() method reuses the cached modules, while the file's modification time is the same
+ * 
+ */
+TEST(ModulesTest, TestFindCached)
+{
+	const fs::path directory{"cached"};
+	const auto file = directory / "greet.cpp";
+	fs::create_directories(directory);
+	std::ofstream{file} << "export module greet;\n";
+
+	{
+		Modules modules{directory / "units"};
+		EXPECT_EQ(modules.Find(file).provides, "greet");
+		modules.Save();
+	}
+
+	// The file isn't read again, as it's modification time is the same
+	const auto time = fs::last_write_time(file);
+	std::ofstream{file} << "export module hello;\n";
+	fs::last_write_time(file, time);
+
+	Modules modules{directory / "units"};
+	EXPECT_EQ(modules.Find(file).provides, "greet");
+
+	fs::remove_all(directory);
+}
+
+/**
+ * @brief Check if the Find() method scans the file again, once it's changed
+ * 
+ */
+TEST(ModulesTest, TestFindChanged)
+{
+	const fs::path directory{"changed"};
+	const auto file = directory / "greet.cpp";
+	fs::create_directories(directory);
+	std::ofstream{file} << "export module greet;\n";
+
+	{
+		Modules modules{directory / "units"};
+		EXPECT_EQ(modules.Find(file).provides, "greet");
+		modules.Save();
+	}
+
+	std::ofstream{file} << "export module hello;\nimport greet;\n";
+	fs::last_write_time(file, fs::last_write_time(file) + std::chrono::seconds{1});
+
+	Modules modules{directory / "units"};
+	const auto unit = modules.Find(file);
+	EXPECT_EQ(unit.provides, "hello");
+	EXPECT_EQ(unit.imports, (std::vector<std::string>{"greet"}));
+	EXPECT_TRUE(Modules{"missing"}.Find(directory / "missing.cpp").provides.empty());
+
+	fs::remove_all(directory);
+}
\ No newline at end of file
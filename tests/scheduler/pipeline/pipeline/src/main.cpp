@@ -19,16 +19,27 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <stack>
+#include <string>
+#include <vector>
 
 #include "exceptions/filenotfoundexception.hpp"
+#include "scheduler/exceptions/importcycleexception.hpp"
 #include "scheduler/exceptions/linkerrorexception.hpp"
 #include "scheduler/exceptions/nofilesspecifiedexception.hpp"
+#include "scheduler/exceptions/precompilationcommandexception.hpp"
 #include "scheduler/pipeline/job.hpp"
 #include "scheduler/pipeline/pipeline.hpp"
+#include "scheduler/threadpool.hpp"
 
 extern std::stack<bool> result;
+extern std::vector<std::string> executed;
+extern std::vector<std::filesystem::path> directories;
+extern std::vector<std::filesystem::path> precompiled;
+extern std::vector<std::filesystem::path> compiled;
 
 /**
  * @brief Check if the Run() method works correctly
@@ -36,18 +47,21 @@ extern std::stack<bool> result;
  */
 TEST(PipelineTest, TestRun)
 {
+	const std::filesystem::path project{"test"};
 	const std::filesystem::path file{"main.cpp"};
-	std::ofstream file_handle{file};
+	std::filesystem::create_directory(project);
+	std::ofstream file_handle{project / file};
 	file_handle.close();
 
 	scheduler::pipeline::Job job{"test"};
-	job.SetProjectPath(std::filesystem::path{"test"});
+	job.SetProjectPath(project);
 	job.AddFile(file);
 
+	scheduler::ThreadPool pool{1};
 	scheduler::pipeline::Pipeline pipeline{std::move(job)};
-	EXPECT_NO_THROW(pipeline.Run());
+	EXPECT_NO_THROW(pipeline.Run(pool));
 
-	std::filesystem::remove(file);
+	std::filesystem::remove_all(project);
 }
 
 /**
@@ -56,19 +70,22 @@ TEST(PipelineTest, TestRun)
  */
 TEST(PipelineTest, TestLinkFail)
 {
+	const std::filesystem::path project{"test"};
 	const std::filesystem::path file{"main.cpp"};
-	std::ofstream file_handle{file};
+	std::filesystem::create_directory(project);
+	std::ofstream file_handle{project / file};
 	file_handle.close();
 	result.push(false);
 
 	scheduler::pipeline::Job job{"test"};
-	job.SetProjectPath(std::filesystem::path{"test"});
+	job.SetProjectPath(project);
 	job.AddFile(file); // Needed to do not cause NoFilesSpecifiedException
 
+	scheduler::ThreadPool pool{1};
 	scheduler::pipeline::Pipeline pipeline{std::move(job)};
-	EXPECT_THROW(pipeline.Run(), scheduler::exceptions::LinkErrorException);
+	EXPECT_THROW(pipeline.Run(pool), scheduler::exceptions::LinkErrorException);
 
-	std::filesystem::remove(file);
+	std::filesystem::remove_all(project);
 }
 
 /**
@@ -80,8 +97,9 @@ TEST(PipelineTest, TestNoFilesFail)
 	scheduler::pipeline::Job job{"test"};
 	job.SetProjectPath(std::filesystem::path{"test"});
 
+	scheduler::ThreadPool pool{1};
 	scheduler::pipeline::Pipeline pipeline{std::move(job)};
-	EXPECT_THROW(pipeline.Run(), scheduler::exceptions::NoFilesSpecifiedException);
+	EXPECT_THROW(pipeline.Run(pool), scheduler::exceptions::NoFilesSpecifiedException);
 }
 
 /**
@@ -94,6 +112,294 @@ TEST(PipelineTest, TestRunFileNotFound)
 	job.SetProjectPath(std::filesystem::path{"test"});
 	job.AddFile(std::filesystem::path{"main.cpp"});
 
+	scheduler::ThreadPool pool{1};
+	scheduler::pipeline::Pipeline pipeline{std::move(job)};
+	EXPECT_THROW(pipeline.Run(pool), exceptions::FileNotFoundException);
+}
+
+/**
+ * @brief Check if the command is skipped, if it's outputs are newer than it's inputs
+ * 
+ */
+TEST(PipelineTest, TestRunCommandUpToDate)
+{
+	const std::filesystem::path project{"test"};
+	std::filesystem::create_directory(project);
+	std::ofstream{project / "main.cpp"}.close();
+	std::ofstream{project / "schema.txt"}.close();
+	std::ofstream{project / "schema.hpp"}.close();
+
+	const auto run = [&project] {
+		scheduler::pipeline::Job job{"test"};
+		job.SetProjectPath(project);
+		job.AddFile("main.cpp");
+		job.SetPreCompilationCommands({{"generate", {"schema.txt"}, {"schema.hpp"}}});
+
+		scheduler::ThreadPool pool{1};
+		scheduler::pipeline::Pipeline pipeline{std::move(job)};
+		pipeline.Run(pool);
+
+		const auto count = std::count(executed.begin(), executed.end(), "generate");
+		executed.clear();
+		return count;
+	};
+
+	// The command hasn't been run yet, so the outputs are not trusted
+	const auto time = std::filesystem::last_write_time(project / "schema.txt");
+	std::filesystem::last_write_time(project / "schema.hpp", time + std::chrono::seconds{1});
+	EXPECT_EQ(run(), 1);
+	EXPECT_EQ(run(), 0);
+
+	// A newer input makes the command run again
+	std::filesystem::last_write_time(project / "schema.txt", time + std::chrono::seconds{2});
+	EXPECT_EQ(run(), 1);
+
+	std::filesystem::remove_all(project);
+	std::filesystem::remove_all(".bbs-cache");
+}
+
+/**
+ * @brief Check if the command runs in the project's directory, where it's inputs and outputs are looked for
+ * 
+ */
+TEST(PipelineTest, TestRunCommandDirectory)
+{
+	const std::filesystem::path project{"test"};
+	std::filesystem::create_directory(project);
+	std::ofstream{project / "main.cpp"}.close();
+	executed.clear();
+	directories.clear();
+
+	scheduler::pipeline::Job job{"test"};
+	job.SetProjectPath(project);
+	job.AddFile("main.cpp");
+	job.SetPreCompilationCommands({{"generate", {}, {"schema.hpp"}}});
+
+	scheduler::ThreadPool pool{1};
+	scheduler::pipeline::Pipeline pipeline{std::move(job)};
+	ASSERT_NO_THROW(pipeline.Run(pool));
+
+	const auto command = std::find(executed.begin(), executed.end(), "generate");
+	ASSERT_NE(command, executed.end());
+	EXPECT_EQ(directories[command - executed.begin()], project);
+	executed.clear();
+	directories.clear();
+
+	std::filesystem::remove_all(project);
+	std::filesystem::remove_all(".bbs-cache");
+}
+
+/**
+ * @brief Check if the Run() method throws an exception when the pre-compilation command fails
+ * 
+ */
+TEST(PipelineTest, TestRunCommandFail)
+{
+	scheduler::pipeline::Job job{"test"};
+	job.SetProjectPath(std::filesystem::path{"test"});
+	job.AddFile(std::filesystem::path{"main.cpp"});
+	job.SetPreCompilationCommands({{"generate"}});
+	result.push(false);
+
+	scheduler::ThreadPool pool{1};
+	scheduler::pipeline::Pipeline pipeline{std::move(job)};
+	EXPECT_THROW(pipeline.Run(pool), scheduler::exceptions::PreCompilationCommandException);
+	executed.clear();
+}
+
+/**
+ * @brief Check if the sources, generated by the commands, are compiled with the project's files
+ * 
+ */
+TEST(PipelineTest, TestRunGeneratedSources)
+{
+	scheduler::pipeline::Job job{"test"};
+	job.SetProjectPath(std::filesystem::path{"test"});
+	job.SetPreCompilationCommands({{"generate", {}, {"generated.cpp", "generated.hpp"}}});
+
+	// The file is not created by the stubbed command, but it is expected to be compiled
+	scheduler::ThreadPool pool{1};
+	scheduler::pipeline::Pipeline pipeline{std::move(job)};
+	EXPECT_THROW(pipeline.Run(pool), exceptions::FileNotFoundException);
+	executed.clear();
+	std::filesystem::remove_all("test");
+	std::filesystem::remove_all(".bbs-cache");
+}
+
+/**
+ * @brief Check if the header is precompiled once per run, through a wrapper in the project's output
+ * 
+ */
+TEST(PipelineTest, TestRunPrecompiledHeader)
+{
+	const std::filesystem::path project{"test"};
+	std::filesystem::create_directory(project);
+	std::ofstream{project / "main.cpp"}.close();
+	std::ofstream{project / "common.hpp"}.close();
+
+	scheduler::pipeline::Job job{"test"};
+	job.SetProjectPath(project);
+	job.AddFile("main.cpp");
+	job.SetPrecompiledHeader("common.hpp");
+
+	scheduler::ThreadPool pool{1};
+	scheduler::pipeline::Pipeline pipeline{std::move(job)};
+	ASSERT_NO_THROW(pipeline.Run(pool));
+
+	ASSERT_EQ(precompiled.size(), 1);
+	EXPECT_EQ(precompiled.front().filename(), "common.hpp");
+	EXPECT_TRUE(std::filesystem::exists(precompiled.front()));
+	precompiled.clear();
+
+	std::filesystem::remove_all(project);
+}
+
+/**
+ * @brief Check if the Run() method throws an exception, if the header to precompile was not found
+ * 
+ */
+TEST(PipelineTest, TestRunPrecompiledHeaderNotFound)
+{
+	const std::filesystem::path project{"test"};
+	std::filesystem::create_directory(project);
+	std::ofstream{project / "main.cpp"}.close();
+
+	scheduler::pipeline::Job job{"test"};
+	job.SetProjectPath(project);
+	job.AddFile("main.cpp");
+	job.SetPrecompiledHeader("common.hpp");
+
+	scheduler::ThreadPool pool{1};
+	scheduler::pipeline::Pipeline pipeline{std::move(job)};
+	EXPECT_THROW(pipeline.Run(pool), exceptions::FileNotFoundException);
+	EXPECT_TRUE(precompiled.empty());
+
+	std::filesystem::remove_all(project);
+}
+
+/**
+ * @brief Check if nothing is precompiled, until the headers to precompile are selected by a build
+ * 
+ */
+TEST(PipelineTest, TestRunAutomaticPrecompiledHeader)
+{
+	const std::filesystem::path project{"test"};
+	std::filesystem::create_directory(project);
+	std::ofstream{project / "main.cpp"}.close();
+
+	scheduler::pipeline::Job job{"test"};
+	job.SetProjectPath(project);
+	job.AddFile("main.cpp");
+	job.SetPrecompiledHeader("*");
+
+	scheduler::ThreadPool pool{1};
 	scheduler::pipeline::Pipeline pipeline{std::move(job)};
-	EXPECT_THROW(pipeline.Run(), exceptions::FileNotFoundException);
+	EXPECT_NO_THROW(pipeline.Run(pool));
+	EXPECT_TRUE(precompiled.empty());
+
+	std::filesystem::remove_all(project);
+}
+
+/**
+ * @brief Check if the files are grouped into a unity file, except for the isolated ones
+ * 
+ */
+TEST(PipelineTest, TestRunUnity)
+{
+	const std::filesystem::path project{"test"};
+	std::filesystem::create_directory(project);
+	for(const auto& file : {"a.cpp", "b.cpp", "c.cpp"})
+	{
+		std::ofstream{project / file}.close();
+	}
+
+	scheduler::pipeline::Job job{"test"};
+	job.SetProjectPath(project);
+	job.AddFile("a.cpp");
+	job.AddFile("b.cpp");
+	job.AddFile("c.cpp");
+	job.AddIsolatedFile("c.cpp");
+
+	scheduler::ThreadPool pool{1};
+	scheduler::pipeline::Pipeline pipeline{std::move(job), true};
+	ASSERT_NO_THROW(pipeline.Run(pool));
+
+	std::vector<std::filesystem::path> batches{};
+	for(const auto& entry : std::filesystem::directory_iterator{project / "unity"})
+	{
+		batches.push_back(entry.path());
+	}
+
+	ASSERT_EQ(batches.size(), 1);
+	std::ifstream stream{batches.front()};
+	const std::string content{std::istreambuf_iterator<char>{stream}, {}};
+	EXPECT_NE(content.find("a.cpp"), std::string::npos);
+	EXPECT_NE(content.find("b.cpp"), std::string::npos);
+	EXPECT_EQ(content.find("c.cpp"), std::string::npos);
+
+	std::filesystem::remove_all(project);
+}
+
+/**
+ * @brief Check if the interfaces of the modules are compiled before the files, that import them
+ * 
+ */
+TEST(PipelineTest, TestRunModules)
+{
+	const std::filesystem::path project{"test"};
+	std::filesystem::create_directory(project);
+	std::ofstream{project / "main.cpp"} << "import greet;\n";
+	std::ofstream{project / "greet.cpp"} << "export module greet;\nexport import :name;\n";
+	std::ofstream{project / "name.cpp"} << "export module greet:name;\n";
+
+	scheduler::pipeline::Job job{"test"};
+	job.SetProjectPath(project);
+	job.AddFile("main.cpp");
+	job.AddFile("greet.cpp");
+	job.AddFile("name.cpp");
+
+	compiled.clear();
+	scheduler::ThreadPool pool{1};
+	scheduler::pipeline::Pipeline pipeline{std::move(job)};
+	ASSERT_NO_THROW(pipeline.Run(pool));
+
+	std::vector<std::filesystem::path> order{};
+	for(const auto& file : compiled)
+	{
+		order.push_back(file.filename());
+	}
+	EXPECT_EQ(order, (std::vector<std::filesystem::path>{"name.cpp", "greet.cpp", "main.cpp"}));
+
+	std::ifstream stream{project / "modules" / "mapper"};
+	const std::string mapper{std::istreambuf_iterator<char>{stream}, {}};
+	EXPECT_NE(mapper.find("greet "), std::string::npos);
+	EXPECT_NE(mapper.find("greet:name "), std::string::npos);
+
+	compiled.clear();
+	std::filesystem::remove_all(project);
+}
+
+/**
+ * @brief Check if the Run() method throws an exception, if the modules import each other
+ * 
+ */
+TEST(PipelineTest, TestRunModulesCycle)
+{
+	const std::filesystem::path project{"test"};
+	std::filesystem::create_directory(project);
+	std::ofstream{project / "first.cpp"} << "export module first;\nimport second;\n";
+	std::ofstream{project / "second.cpp"} << "export module second;\nimport first;\n";
+
+	scheduler::pipeline::Job job{"test"};
+	job.SetProjectPath(project);
+	job.AddFile("first.cpp");
+	job.AddFile("second.cpp");
+
+	compiled.clear();
+	scheduler::ThreadPool pool{1};
+	scheduler::pipeline::Pipeline pipeline{std::move(job)};
+	EXPECT_THROW(pipeline.Run(pool), scheduler::exceptions::ImportCycleException);
+	EXPECT_TRUE(compiled.empty());
+
+	std::filesystem::remove_all(project);
 }
\ No newline at end of file
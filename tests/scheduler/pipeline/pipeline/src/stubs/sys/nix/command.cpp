@@ -20,23 +20,27 @@
 #include "sys/nix/command.hpp"
 
 #include <stack>
+#include <vector>
 
 std::stack<bool> result{};
+std::vector<std::string> executed{};
+std::vector<std::filesystem::path> directories{};
 
 namespace sys::nix
 {
 Command::Command(std::string line)
-{
-	// noop
-}
+	: command_{std::move(line)}
+{}
 
 Command::Command(std::string program, std::string parameters)
-{
-	// noop
-}
+	: command_{std::move(program + " " + parameters)}
+{}
 
 bool Command::Execute()
 {
+	executed.push_back(command_);
+	directories.push_back(directory_);
+
 	if(result.empty())
 	{
 		return true;
@@ -51,4 +55,19 @@ std::string Command::GetOutput() const
 {
 	return {};
 }
+
+void Command::SetListener(Listener listener)
+{
+	// noop
+}
+
+void Command::SetDirectory(std::filesystem::path directory)
+{
+	directory_ = std::move(directory);
+}
+
+Usage Command::GetUsage() const
+{
+	return {};
+}
 } // namespace sys::nix
\ No newline at end of file
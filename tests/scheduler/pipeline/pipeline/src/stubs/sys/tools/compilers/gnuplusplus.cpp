@@ -0,0 +1,83 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "sys/tools/compilers/gnuplusplus.hpp"
+
+#include "sys/nix/command.hpp"
+
+std::vector<std::filesystem::path> precompiled{};
+std::vector<std::filesystem::path> compiled{};
+
+namespace sys::tools::compilers
+{
+const std::string GNUPlusPlus::kCompiler{"g++"};
+
+GNUPlusPlus::GNUPlusPlus(std::string&& flags,
+						 std::vector<std::filesystem::path>&& include_directories)
+	: kFlags{std::move(flags)}
+	, kDirectories{std::move(include_directories)}
+{}
+
+void GNUPlusPlus::Compile(const std::filesystem::path& file, const std::filesystem::path& out,
+						  const Command::Listener& listener)
+{
+	compiled.push_back(file);
+}
+
+void GNUPlusPlus::CompileModule(const std::filesystem::path& file, const std::filesystem::path& out,
+								const Command::Listener& listener)
+{
+	compiled.push_back(file);
+}
+
+void GNUPlusPlus::Precompile(const std::filesystem::path& header, const std::filesystem::path& out,
+							 const Command::Listener& listener)
+{
+	precompiled.push_back(header);
+}
+
+void GNUPlusPlus::SetPrecompiledHeader(const std::filesystem::path& header)
+{
+	header_ = header;
+}
+
+void GNUPlusPlus::SetModuleMapper(const std::filesystem::path& mapper)
+{
+	mapper_ = mapper;
+}
+
+std::vector<std::filesystem::path>
+GNUPlusPlus::GetDependencies(const std::filesystem::path& file, const Command::Listener& listener) const
+{
+	return {};
+}
+
+std::string GNUPlusPlus::Preprocess(const std::filesystem::path& file, const Command::Listener& listener) const
+{
+	return {};
+}
+
+bool GNUPlusPlus::Link(const std::vector<std::filesystem::path>& files,
+					   const std::filesystem::path& out, const Command::Listener& listener)
+{
+	// The result is controlled by the stubbed command
+	sys::nix::Command command{kCompiler, out.string()};
+	return command.Execute();
+}
+} // namespace sys::tools::compilers
\ No newline at end of file
@@ -0,0 +1,212 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "scheduler/pipeline/unity.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief A text fixture to test scheduler::pipeline::Unity component
+ * 
+ */
+class UnityTest : public ::testing::Test
+{
+protected:
+	/**
+	 * @brief Create the directory for the sources
+	 * 
+	 */
+	void SetUp() override
+	{
+		fs::create_directories(kDirectory);
+	}
+
+	/**
+	 * @brief Remove the sources and the generated files
+	 * 
+	 */
+	void TearDown() override
+	{
+		fs::remove_all(kDirectory);
+	}
+
+	/**
+	 * @brief Create the sources of the given size
+	 * 
+	 * @param count - the number of the sources
+	 * @param size - the size of every source
+	 * @param prefix - the prefix of the names of the sources
+	 * @return std::vector<fs::path> - the created sources
+	 */
+	static std::vector<fs::path> Create(std::size_t count, std::size_t size, const std::string& prefix = "source")
+	{
+		std::vector<fs::path> sources{};
+		for(std::size_t index = 0; index < count; ++index)
+		{
+			sources.push_back(fs::absolute(kDirectory / (prefix + std::to_string(index) + ".cpp")));
+			std::ofstream{sources.back()} << std::string(size, ' ');
+		}
+
+		return sources;
+	}
+
+	/**
+	 * @brief Read the file
+	 * 
+	 * @param file - the file to read
+	 * @return std::string - the contents of the file
+	 */
+	static std::string Read(const fs::path& file)
+	{
+		std::ifstream stream{file};
+		return {std::istreambuf_iterator<char>{stream}, {}};
+	}
+
+protected:
+	/**
+	 * @brief The directory, used by the test suite
+	 * 
+	 */
+	static const fs::path kDirectory;
+
+	/**
+	 * @brief The instance to test
+	 * 
+	 */
+	scheduler::pipeline::Unity instance_{fs::absolute(kDirectory / "unity"), fs::absolute(kDirectory)};
+};
+
+const fs::path UnityTest::kDirectory{"batches"};
+
+/**
+ * @brief Check if the Group() method puts the small sources into a single unity file
+ * 
+ */
+TEST_F(UnityTest, TestGroup)
+{
+	const auto sources = Create(4, 1024);
+
+	const auto result = instance_.Group(sources, 1);
+	ASSERT_EQ(result.size(), 1);
+	EXPECT_EQ(result.front().parent_path(), fs::absolute(kDirectory / "unity"));
+
+	const auto content = Read(result.front());
+	for(const auto& source : sources)
+	{
+		EXPECT_NE(content.find("#include \"" + source.string() + "\""), std::string::npos);
+	}
+}
+
+/**
+ * @brief Check if the Group() method keeps a single source as it is
+ * 
+ */
+TEST_F(UnityTest, TestGroupSingle)
+{
+	const auto sources = Create(1, 1024);
+
+	EXPECT_EQ(instance_.Group(sources, 1), sources);
+}
+
+/**
+ * @brief Check if the Group() method splits the sources into the batches of about the same size
+ * 
+ */
+TEST_F(UnityTest, TestGroupBalanced)
+{
+	auto sources = Create(8, 64 * 1024, "large");
+	const auto small = Create(8, 1024, "small");
+	sources.insert(sources.end(), small.begin(), small.end());
+
+	const auto result = instance_.Group(sources, 8);
+	EXPECT_GE(result.size(), 5);
+	EXPECT_LE(result.size(), 9);
+}
+
+/**
+ * @brief Check if the Group() method only changes the batch of the added source
+ * 
+ */
+TEST_F(UnityTest, TestGroupStable)
+{
+	auto sources      = Create(64, 16 * 1024);
+	const auto before = instance_.Group(sources, 64);
+	ASSERT_GT(before.size(), 4);
+
+	sources.push_back(Create(1, 16 * 1024, "source32a").front());
+	const auto after = instance_.Group(sources, 64);
+
+	const auto kept = std::count_if(before.begin(), before.end(), [&after](const fs::path& batch) {
+		return std::find(after.begin(), after.end(), batch) != after.end();
+	});
+	EXPECT_GE(kept + 1, before.size());
+}
+
+/**
+ * @brief Check if the Group() method makes the same batches, wherever the project is
+ * 
+ */
+TEST_F(UnityTest, TestGroupRelocated)
+{
+	const auto group = [](const fs::path& root) {
+		fs::create_directories(root);
+		std::vector<fs::path> sources{};
+		for(std::size_t index = 0; index < 64; ++index)
+		{
+			sources.push_back(fs::absolute(root / ("source" + std::to_string(index) + ".cpp")));
+			std::ofstream{sources.back()} << std::string(16 * 1024, ' ');
+		}
+
+		std::vector<fs::path> names{};
+		const scheduler::pipeline::Unity unity{fs::absolute(root / "unity"), fs::absolute(root)};
+		for(const auto& batch : unity.Group(sources, 64))
+		{
+			names.push_back(batch.filename());
+		}
+
+		return names;
+	};
+
+	EXPECT_EQ(group(kDirectory / "first"), group(kDirectory / "second" / "nested"));
+}
+
+/**
+ * @brief Check if the Group() method doesn't rewrite the unchanged unity files and removes the stale ones
+ * 
+ */
+TEST_F(UnityTest, TestGroupUnchanged)
+{
+	const auto sources = Create(4, 1024);
+	const auto stale   = instance_.Group({sources[1], sources[2]}, 1).front();
+
+	const auto result = instance_.Group(sources, 1);
+	const auto time   = fs::last_write_time(result.front());
+	EXPECT_FALSE(fs::exists(stale));
+
+	EXPECT_EQ(instance_.Group(sources, 1), result);
+	EXPECT_EQ(fs::last_write_time(result.front()), time);
+}
\ No newline at end of file
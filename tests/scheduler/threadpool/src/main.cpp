@@ -0,0 +1,83 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+#include "scheduler/threadpool.hpp"
+
+/**
+ * @brief Check if the constructor starts at least one worker
+ * 
+ */
+TEST(ThreadPoolTest, TestConstructorNoWorkers)
+{
+	scheduler::ThreadPool pool{0};
+	EXPECT_EQ(pool.GetSize(), 1);
+}
+
+/**
+ * @brief Check if all the submitted tasks are run before Wait() returns
+ * 
+ */
+TEST(ThreadPoolTest, TestSubmit)
+{
+	constexpr int kTasks = 1000;
+	std::atomic<int> counter{0};
+
+	scheduler::ThreadPool pool{4};
+	for(int i = 0; i < kTasks; ++i)
+	{
+		pool.Submit([&counter] { ++counter; });
+	}
+	pool.Wait();
+
+	EXPECT_EQ(counter, kTasks);
+}
+
+/**
+ * @brief Check if Wait() rethrows the exception, thrown by a task
+ * 
+ */
+TEST(ThreadPoolTest, TestWaitException)
+{
+	scheduler::ThreadPool pool{2};
+	pool.Submit([] { throw std::runtime_error("error"); });
+
+	EXPECT_THROW(pool.Wait(), std::runtime_error);
+}
+
+/**
+ * @brief Check if the pool can be used again after an exception
+ * 
+ */
+TEST(ThreadPoolTest, TestWaitAfterException)
+{
+	std::atomic<int> counter{0};
+
+	scheduler::ThreadPool pool{2};
+	pool.Submit([] { throw std::runtime_error("error"); });
+	EXPECT_THROW(pool.Wait(), std::runtime_error);
+
+	pool.Submit([&counter] { ++counter; });
+	EXPECT_NO_THROW(pool.Wait());
+	EXPECT_EQ(counter, 1);
+}
\ No newline at end of file
@@ -21,12 +21,12 @@
 
 namespace lexer
 {
-void Context::Update(std::string&& value)
+void Context::Update(std::string_view value)
 {
 	// noop
 }
 
-std::string Context::GetLine() const
+std::string_view Context::GetLine() const
 {
 	return line_;
 }
@@ -30,12 +30,12 @@ const Context& Lexer::GetContext() const
 	return scanner_.GetContext();
 }
 
-std::shared_ptr<Lexer::Token> Lexer::Next()
+const Lexer::Lexeme* Lexer::Next()
 {
 	return {};
 }
 
-std::shared_ptr<Lexer::Token> Lexer::Get() const
+const Lexer::Lexeme* Lexer::Get() const
 {
 	return {};
 }
@@ -22,6 +22,7 @@
 namespace lexer
 {
 Scanner::Scanner(const std::filesystem::path& path)
+	: file_{path}
 {
 	// noop
 }
@@ -41,6 +42,21 @@ void Scanner::Move()
 	// noop
 }
 
+void Scanner::Move(std::size_t count)
+{
+	// noop
+}
+
+std::string_view Scanner::Peek() const
+{
+	return {};
+}
+
+std::size_t Scanner::GetOffset() const
+{
+	return {};
+}
+
 const lexer::Context& Scanner::GetContext() const
 {
 	return context_;
@@ -50,4 +66,9 @@ void Scanner::Skip()
 {
 	// noop
 }
+
+bool Scanner::Read()
+{
+	return false;
+}
 } // namespace lexer
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "parser/cache.hpp"
+
+namespace parser
+{
+Cache::Cache(std::filesystem::path directory)
+{
+	// noop
+}
+
+std::optional<scheduler::pipeline::Job> Cache::Load(const std::filesystem::path& file) const
+{
+	return {};
+}
+
+void Cache::Store(const std::filesystem::path& file, const scheduler::pipeline::Job& job) const
+{
+	// noop
+}
+
+std::filesystem::path Cache::GetEntryPath(const std::filesystem::path& file) const
+{
+	return {};
+}
+
+std::uint64_t Cache::Hash(std::string_view data)
+{
+	return 0;
+}
+} // namespace parser
\ No newline at end of file
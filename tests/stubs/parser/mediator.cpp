@@ -19,8 +19,6 @@
 
 #include "parser/mediator.hpp"
 
-#include "parser/states/state.hpp"
-
 namespace parser
 {
 Mediator::Mediator()
@@ -28,14 +26,14 @@ Mediator::Mediator()
 	// noop
 }
 
-void Mediator::SetState(std::unique_ptr<states::State> state)
+void Mediator::SetState(states::Type state)
 {
 	// noop
 }
 
-std::unique_ptr<states::State> Mediator::GetState()
+states::Type Mediator::GetState()
 {
-	return {};
+	return states::Type::kNone;
 }
 
 void Mediator::SetJob(std::unique_ptr<scheduler::pipeline::Job> job)
@@ -53,12 +51,12 @@ scheduler::pipeline::Job Mediator::GetJob()
 	return {""};
 }
 
-void Mediator::DeclareVariable(std::string id, std::string value)
+void Mediator::DeclareVariable(std::string_view id, std::string_view value)
 {
 	// noop
 }
 
-std::string Mediator::GetVariableValue(std::string id) const
+std::string_view Mediator::GetVariableValue(std::string_view id) const
 {
 	return {};
 }
@@ -19,8 +19,6 @@
 
 #include "parser/states/keywords/cflags.hpp"
 
-#include "parser/states/statement.hpp"
-
 namespace parser::states::keywords
 {
 CFlags::CFlags(Mediator& mediator)
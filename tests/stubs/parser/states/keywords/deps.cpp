@@ -19,8 +19,6 @@
 
 #include "parser/states/keywords/deps.hpp"
 
-#include "parser/states/statement.hpp"
-
 namespace parser::states::keywords
 {
 Deps::Deps(Mediator& mediator)
@@ -31,4 +29,9 @@ void Deps::Process(lexer::Lexer& lexer)
 {
 	// noop
 }
+
+void Deps::Add(std::string value)
+{
+	// noop
+}
 } // namespace parser::states::keywords
\ No newline at end of file
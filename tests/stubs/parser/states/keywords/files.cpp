@@ -31,4 +31,9 @@ void Files::Process(lexer::Lexer& lexer)
 {
 	// noop
 }
+
+void Files::Add(std::string value)
+{
+	// noop
+}
 } // namespace parser::states::keywords
\ No newline at end of file
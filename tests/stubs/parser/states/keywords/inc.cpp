@@ -19,8 +19,6 @@
 
 #include "parser/states/keywords/inc.hpp"
 
-#include "parser/states/statement.hpp"
-
 namespace parser::states::keywords
 {
 Inc::Inc(Mediator& mediator)
@@ -31,4 +29,9 @@ void Inc::Process(lexer::Lexer& lexer)
 {
 	// noop
 }
+
+void Inc::Add(std::string value)
+{
+	// noop
+}
 } // namespace parser::states::keywords
\ No newline at end of file
@@ -19,8 +19,6 @@
 
 #include "parser/states/keywords/let.hpp"
 
-#include "parser/states/statement.hpp"
-
 namespace parser::states::keywords
 {
 Let::Let(Mediator& mediator)
@@ -32,7 +30,7 @@ void Let::Process(lexer::Lexer& lexer)
 	// noop
 }
 
-void Let::Match(tokens::Token* token, tokens::Operator::Type value)
+void Let::Match(const tokens::Lexeme* token, tokens::Operator::Type value)
 {
 	// noop
 }
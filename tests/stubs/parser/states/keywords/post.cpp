@@ -19,12 +19,10 @@
 
 #include "parser/states/keywords/post.hpp"
 
-#include "parser/states/statement.hpp"
-
 namespace parser::states::keywords
 {
 Post::Post(Mediator& mediator)
-	: Array{mediator}
+	: Commands{mediator}
 {}
 
 void Post::Process(lexer::Lexer& lexer)
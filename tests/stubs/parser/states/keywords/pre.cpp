@@ -19,12 +19,10 @@
 
 #include "parser/states/keywords/pre.hpp"
 
-#include "parser/states/statement.hpp"
-
 namespace parser::states::keywords
 {
 Pre::Pre(Mediator& mediator)
-	: Array{mediator}
+	: Commands{mediator}
 {}
 
 void Pre::Process(lexer::Lexer& lexer)
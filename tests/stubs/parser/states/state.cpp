@@ -27,13 +27,23 @@ State::State(Mediator& mediator)
 	: mediator_{mediator}
 {}
 
-std::shared_ptr<tokens::Token> State::SkipSeparators(lexer::Lexer& lexer)
+const tokens::Lexeme* State::SkipSeparators(lexer::Lexer& lexer)
 {
 	return {};
 }
 
-void State::Match(tokens::Token* token, tokens::Punctuator::Type value)
+void State::Match(const tokens::Lexeme* token, tokens::Punctuator::Type value)
 {
 	// noop
 }
+
+bool State::Is(const tokens::Lexeme* token, tokens::Punctuator::Type value)
+{
+	return {};
+}
+
+bool State::Is(const tokens::Lexeme* token, tokens::Operator::Type value)
+{
+	return {};
+}
 } // namespace parser::states
\ No newline at end of file
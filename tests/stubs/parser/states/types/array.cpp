@@ -33,8 +33,18 @@ void Array::Process(lexer::Lexer& lexer)
 	// noop
 }
 
-std::vector<std::string> Array::GetValue() const
+const std::vector<std::string>& Array::GetValue() const
 {
-	return {};
+	return value_;
+}
+
+void Array::Add(std::string value)
+{
+	// noop
+}
+
+const tokens::Lexeme* Array::ProcessClauses(lexer::Lexer& lexer, const tokens::Lexeme* token)
+{
+	return token;
 }
 } // namespace parser::states::types
\ No newline at end of file
@@ -0,0 +1,52 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "parser/states/types/commands.hpp"
+
+namespace parser::states::types
+{
+Commands::Commands(Mediator& mediator)
+	: Array{mediator}
+{}
+
+void Commands::Process(lexer::Lexer& lexer)
+{
+	// noop
+}
+
+const std::vector<scheduler::pipeline::Job::Command>& Commands::GetCommands() const
+{
+	return commands_;
+}
+
+void Commands::Add(std::string value)
+{
+	// noop
+}
+
+const tokens::Lexeme* Commands::ProcessClauses(lexer::Lexer& lexer, const tokens::Lexeme* token)
+{
+	return token;
+}
+
+bool Commands::IsWord(const tokens::Lexeme* token, std::string_view value)
+{
+	return false;
+}
+} // namespace parser::states::types
\ No newline at end of file
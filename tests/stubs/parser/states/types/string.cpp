@@ -33,9 +33,9 @@ void String::Process(lexer::Lexer& lexer)
 	// noop
 }
 
-std::string String::GetValue() const
+const std::string& String::GetValue() const
 {
-	return {};
+	return value_;
 }
 
 void String::Clear()
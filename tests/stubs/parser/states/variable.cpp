@@ -30,7 +30,7 @@ void Variable::Process(lexer::Lexer& lexer)
 	// noop
 }
 
-std::string Variable::GetValue() const
+std::string_view Variable::GetValue() const
 {
 	return {};
 }
@@ -32,4 +32,9 @@ std::string Operator::GetValue() const
 {
 	return {};
 }
+
+Lexeme Operator::ToLexeme() const
+{
+	return {Lexeme::Kind::kOperator, static_cast<uint8_t>(type), {}};
+}
 } // namespace parser::tokens
\ No newline at end of file
@@ -32,4 +32,9 @@ std::string Punctuator::GetValue() const
 {
 	return {};
 }
+
+Lexeme Punctuator::ToLexeme() const
+{
+	return {Lexeme::Kind::kPunctuator, static_cast<uint8_t>(type), {}};
+}
 } // namespace parser::tokens
\ No newline at end of file
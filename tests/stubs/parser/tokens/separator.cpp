@@ -32,4 +32,9 @@ std::string Separator::GetValue() const
 {
 	return {};
 }
+
+Lexeme Separator::ToLexeme() const
+{
+	return {Lexeme::Kind::kSeparator, static_cast<uint8_t>(type), {}};
+}
 } // namespace parser::tokens
\ No newline at end of file
@@ -31,4 +31,9 @@ std::string Word::GetValue() const
 {
 	return {};
 }
+
+Lexeme Word::ToLexeme() const
+{
+	return {Lexeme::Kind::kWord, 0, {}};
+}
 } // namespace parser::tokens
\ No newline at end of file
@@ -21,6 +21,10 @@
 
 namespace scheduler
 {
+Executor::Executor(std::size_t jobs)
+	: pool_{jobs}
+{}
+
 void Executor::Add(pipeline::Pipeline pipeline)
 {
 	// noop
@@ -21,13 +21,15 @@
 
 namespace scheduler::pipeline
 {
-Pipeline::Pipeline(Job job)
+Pipeline::Pipeline(Job job, bool unity)
 	: job_{std::move(job)}
+	, unity_{unity}
+	, logger_{utils::Logger::GetInstance("")}
 {
 	// noop
 }
 
-void Pipeline::Run() const
+void Pipeline::Run(ThreadPool& pool) const
 {
 	// noop
 }
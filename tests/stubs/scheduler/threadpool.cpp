@@ -0,0 +1,53 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "scheduler/threadpool.hpp"
+
+namespace scheduler
+{
+ThreadPool::ThreadPool(std::size_t size)
+{
+	// noop
+}
+
+ThreadPool::~ThreadPool()
+{
+	// noop
+}
+
+void ThreadPool::Submit(std::function<void()> task)
+{
+	task();
+}
+
+void ThreadPool::Wait()
+{
+	// noop
+}
+
+std::size_t ThreadPool::GetSize() const
+{
+	return 1;
+}
+
+void ThreadPool::Work()
+{
+	// noop
+}
+} // namespace scheduler
\ No newline at end of file
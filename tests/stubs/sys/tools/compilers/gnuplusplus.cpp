@@ -29,15 +29,49 @@ GNUPlusPlus::GNUPlusPlus(std::string&& flags,
 	, kDirectories{std::move(include_directories)}
 {}
 
-void GNUPlusPlus::Compile(const std::filesystem::path& file, const std::filesystem::path& out)
+void GNUPlusPlus::Compile(const std::filesystem::path& file, const std::filesystem::path& out,
+						  const Command::Listener& listener)
+{
+	// noop
+}
+
+void GNUPlusPlus::CompileModule(const std::filesystem::path& file, const std::filesystem::path& out,
+								const Command::Listener& listener)
+{
+	// noop
+}
+
+void GNUPlusPlus::Precompile(const std::filesystem::path& header, const std::filesystem::path& out,
+							 const Command::Listener& listener)
+{
+	// noop
+}
+
+void GNUPlusPlus::SetPrecompiledHeader(const std::filesystem::path& header)
+{
+	// noop
+}
+
+void GNUPlusPlus::SetModuleMapper(const std::filesystem::path& mapper)
 {
 	// noop
 }
 
 std::vector<std::filesystem::path>
-GNUPlusPlus::GetDependencies(const std::filesystem::path& file) const
+GNUPlusPlus::GetDependencies(const std::filesystem::path& file, const Command::Listener& listener) const
 {
 	return {};
 }
 
+std::string GNUPlusPlus::Preprocess(const std::filesystem::path& file, const Command::Listener& listener) const
+{
+	return {};
+}
+
+bool GNUPlusPlus::Link(const std::vector<std::filesystem::path>& files,
+					   const std::filesystem::path& out, const Command::Listener& listener)
+{
+	return true;
+}
+
 } // namespace sys::tools::compilers
\ No newline at end of file
@@ -0,0 +1,70 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "sys/walker.hpp"
+
+namespace sys
+{
+Walker::Walker(std::filesystem::path cache, std::size_t jobs)
+	: pool_{jobs}
+{
+	// noop
+}
+
+std::vector<std::filesystem::path> Walker::Glob(const std::filesystem::path& root, std::string_view pattern)
+{
+	return {};
+}
+
+void Walker::Save()
+{
+	// noop
+}
+
+bool Walker::IsPattern(std::string_view value)
+{
+	return false;
+}
+
+std::vector<std::filesystem::path> Walker::Walk(const std::filesystem::path& base, std::size_t depth)
+{
+	return {};
+}
+
+std::shared_ptr<const Walker::Listing> Walker::GetListing(const std::filesystem::path& directory)
+{
+	return {};
+}
+
+void Walker::Load()
+{
+	// noop
+}
+
+bool Walker::Match(const std::string_view* pattern, const std::string_view* pattern_end,
+				   const std::string_view* path, const std::string_view* path_end)
+{
+	return false;
+}
+
+std::vector<std::string_view> Walker::Split(std::string_view value)
+{
+	return {};
+}
+} // namespace sys
\ No newline at end of file
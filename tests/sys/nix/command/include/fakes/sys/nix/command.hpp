@@ -44,5 +44,6 @@ public:
 
 public:
 	using ::sys::nix::Command::command_;
+	using ::sys::nix::Command::usage_;
 };
 } // namespace fakes::sys::nix
\ No newline at end of file
@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+
 #include "fakes/sys/nix/command.hpp"
 
 /**
@@ -52,4 +54,76 @@ TEST(CommandTest, TestExecuteFail)
 {
 	fakes::sys::nix::Command command{"totally-existing-command", "some-parameters"};
 	EXPECT_FALSE(command.Execute());
+}
+
+/**
+ * @brief Check if the output of the command is captured
+ * 
+ */
+TEST(CommandTest, TestGetOutput)
+{
+	fakes::sys::nix::Command command{"echo", "Hello World"};
+	EXPECT_TRUE(command.Execute());
+	EXPECT_EQ(command.GetOutput(), "Hello World\n");
+}
+
+/**
+ * @brief Check if the command runs in the directory, set with SetDirectory()
+ * 
+ */
+TEST(CommandTest, TestSetDirectory)
+{
+	const std::filesystem::path directory{"directory"};
+	std::filesystem::create_directory(directory);
+
+	fakes::sys::nix::Command command{"pwd", ""};
+	command.SetDirectory(directory);
+	EXPECT_TRUE(command.Execute());
+	EXPECT_EQ(command.GetOutput(), std::filesystem::absolute(directory).string() + "\n");
+
+	std::filesystem::remove_all(directory);
+}
+
+/**
+ * @brief Check if the error output of the command is passed to the listener, apart from the output
+ * 
+ */
+TEST(CommandTest, TestSetListener)
+{
+	fakes::sys::nix::Command command{"echo", "Output; echo Error 1>&2"};
+
+	std::string errors{};
+	command.SetListener([&errors](std::string_view data) { errors.append(data); });
+	EXPECT_TRUE(command.Execute());
+	EXPECT_EQ(command.GetOutput(), "Output\n");
+	EXPECT_EQ(errors, "Error\n");
+}
+
+/**
+ * @brief Check if the resource usage is empty before the command is executed
+ * 
+ */
+TEST(CommandTest, TestGetUsageNotExecuted)
+{
+	const fakes::sys::nix::Command command{"echo", ""};
+	const auto usage = command.GetUsage();
+
+	EXPECT_EQ(usage.user_time.count(), 0);
+	EXPECT_EQ(usage.system_time.count(), 0);
+	EXPECT_EQ(usage.max_resident_set_size, 0);
+}
+
+/**
+ * @brief Check if the resource usage of the child process is collected after the execution
+ * 
+ */
+TEST(CommandTest, TestGetUsage)
+{
+	fakes::sys::nix::Command command{"i=0; while [ $i -lt 20000 ]; do i=$((i+1)); done", ""};
+	EXPECT_TRUE(command.Execute());
+
+	const auto usage = command.GetUsage();
+	EXPECT_GT(usage.max_resident_set_size, 0);
+	EXPECT_GT((usage.user_time + usage.system_time).count(), 0);
+	EXPECT_EQ(command.usage_.max_resident_set_size, usage.max_resident_set_size);
 }
\ No newline at end of file
@@ -0,0 +1,85 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "exceptions/filenotfoundexception.hpp"
+#include "sys/nix/mappedfile.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Check if the whole contents of the file are available through the mapping
+ * 
+ */
+TEST(MappedFileTest, TestGetData)
+{
+	const fs::path path{"mapped.bbs"};
+	const std::string data{"Hello\nWorld!"};
+	{
+		std::ofstream file{path};
+		file << data;
+	}
+
+	const sys::nix::MappedFile instance{path};
+	EXPECT_EQ(instance.GetData(), data);
+
+	fs::remove(path);
+}
+
+/**
+ * @brief Check if an empty file is represented by an empty view
+ * 
+ */
+TEST(MappedFileTest, TestGetDataEmptyFile)
+{
+	const fs::path path{"empty.bbs"};
+	std::ofstream{path}.close();
+
+	const sys::nix::MappedFile instance{path};
+	EXPECT_TRUE(instance.GetData().empty());
+
+	fs::remove(path);
+}
+
+/**
+ * @brief Check if the constructor throws an exception if the file is not found
+ * 
+ */
+TEST(MappedFileTest, TestConstructorFileNotFound)
+{
+	EXPECT_THROW(sys::nix::MappedFile instance{"nonexistent.bbs"}, ::exceptions::FileNotFoundException);
+}
+
+/**
+ * @brief Check if the constructor throws an exception if the path is a directory
+ * 
+ */
+TEST(MappedFileTest, TestConstructorDirectory)
+{
+	const fs::path path{"folder"};
+	fs::create_directory(path);
+
+	EXPECT_THROW(sys::nix::MappedFile instance{path}, ::exceptions::FileNotFoundException);
+
+	fs::remove(path);
+}
\ No newline at end of file
@@ -46,4 +46,60 @@ TEST(CompilerFactoryTest, TestCreateUnsupportedCompiler)
 	EXPECT_THROW(
 		sys::tools::CompilerFactory::Create(compiler, "", std::vector<std::filesystem::path>{}),
 		sys::exceptions::UnsupportedCompilerException);
+}
+
+/**
+ * @brief A compiler that does nothing, used to check the registration
+ * 
+ */
+struct DummyCompiler : public sys::tools::Compiler
+{
+	void Compile(const std::filesystem::path& file, const std::filesystem::path& out,
+				 const sys::Command::Listener& listener) override
+	{}
+
+	void CompileModule(const std::filesystem::path& file, const std::filesystem::path& out,
+					   const sys::Command::Listener& listener) override
+	{}
+
+	void Precompile(const std::filesystem::path& header, const std::filesystem::path& out,
+					const sys::Command::Listener& listener) override
+	{}
+
+	void SetPrecompiledHeader(const std::filesystem::path& header) override {}
+
+	void SetModuleMapper(const std::filesystem::path& mapper) override {}
+
+	std::vector<std::filesystem::path>
+	GetDependencies(const std::filesystem::path& file, const sys::Command::Listener& listener) const override
+	{
+		return {};
+	}
+
+	std::string Preprocess(const std::filesystem::path& file, const sys::Command::Listener& listener) const override
+	{
+		return {};
+	}
+
+	bool Link(const std::vector<std::filesystem::path>& files, const std::filesystem::path& out,
+			  const sys::Command::Listener& listener) override
+	{
+		return true;
+	}
+};
+
+/**
+ * @brief Check if the registered compilers are created by their names
+ * 
+ */
+TEST(CompilerFactoryTest, TestRegister)
+{
+	const auto compiler = "dummy";
+	sys::tools::CompilerFactory::Register(compiler, [](auto flags, auto include_directories) {
+		return std::make_unique<DummyCompiler>();
+	});
+
+	const auto instance =
+		sys::tools::CompilerFactory::Create(compiler, "", std::vector<std::filesystem::path>{});
+	EXPECT_TRUE(dynamic_cast<DummyCompiler*>(instance.get()));
 }
\ No newline at end of file
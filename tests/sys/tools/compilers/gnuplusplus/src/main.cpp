@@ -24,6 +24,8 @@
 
 extern bool result;
 extern std::string output;
+extern std::string errors;
+extern std::string arguments;
 
 /**
  * @brief Check if the compilation fails and throws an exception, if the system command returns false
@@ -35,7 +37,7 @@ TEST(GNUPlusPlusTest, TestCompileFail)
 
 	result = false;
 	const std::filesystem::path file{"main.cpp"};
-	EXPECT_THROW(compiler.Compile(file, file), sys::exceptions::CompilationErrorException);
+	EXPECT_THROW(compiler.Compile(file, file, {}), sys::exceptions::CompilationErrorException);
 
 	result = true;
 }
@@ -52,7 +54,84 @@ TEST(GNUPlusPlusTest, TestCompileSuccess)
 	sys::tools::compilers::GNUPlusPlus compiler{"", std::vector<std::filesystem::path>{}};
 
 	const std::filesystem::path file{"main.cpp"};
-	EXPECT_NO_THROW(compiler.Compile(file, file));
+	EXPECT_NO_THROW(compiler.Compile(file, file, {}));
+}
+
+/**
+ * @brief Check if the diagnostics of the compiler are passed to the listener
+ * 
+ */
+TEST(GNUPlusPlusTest, TestCompileListener)
+{
+	sys::tools::compilers::GNUPlusPlus compiler{"", std::vector<std::filesystem::path>{}};
+
+	errors = "main.cpp:1:1: warning: unused variable";
+	std::string diagnostics{};
+	const std::filesystem::path file{"main.cpp"};
+	compiler.Compile(file, file, [&diagnostics](std::string_view data) { diagnostics.append(data); });
+	EXPECT_EQ(diagnostics, errors);
+
+	errors.clear();
+}
+
+/**
+ * @brief Check if the precompilation fails and throws an exception, if the system command returns false
+ * 
+ */
+TEST(GNUPlusPlusTest, TestPrecompileFail)
+{
+	sys::tools::compilers::GNUPlusPlus compiler{"", std::vector<std::filesystem::path>{}};
+
+	result = false;
+	const std::filesystem::path header{"common.hpp"};
+	EXPECT_THROW(compiler.Precompile(header, "common.hpp.gch", {}), sys::exceptions::CompilationErrorException);
+
+	result = true;
+}
+
+/**
+ * @brief Check if the precompiled header is included into the compiled files, but not into their dependencies
+ * 
+ */
+TEST(GNUPlusPlusTest, TestSetPrecompiledHeader)
+{
+	sys::tools::compilers::GNUPlusPlus compiler{"", std::vector<std::filesystem::path>{}};
+
+	const std::filesystem::path file{"main.cpp"};
+	compiler.Compile(file, file, {});
+	EXPECT_EQ(arguments.find("-include"), std::string::npos);
+
+	compiler.SetPrecompiledHeader("common.hpp");
+	compiler.Compile(file, file, {});
+	EXPECT_NE(arguments.find("-include common.hpp"), std::string::npos);
+
+	output = "main.o: main.cpp";
+	compiler.GetDependencies(file, {});
+	EXPECT_EQ(arguments.find("-include"), std::string::npos);
+}
+
+/**
+ * @brief Check if the units of the modules are compiled without the precompiled header, and through the mapper
+ * 
+ */
+TEST(GNUPlusPlusTest, TestCompileModule)
+{
+	sys::tools::compilers::GNUPlusPlus compiler{"", std::vector<std::filesystem::path>{}};
+	compiler.SetPrecompiledHeader("common.hpp");
+
+	const std::filesystem::path file{"greet.cpp"};
+	compiler.CompileModule(file, "greet.o", {});
+	EXPECT_NE(arguments.find("-fmodules-ts"), std::string::npos);
+	EXPECT_EQ(arguments.find("-include"), std::string::npos);
+
+	compiler.SetModuleMapper("mapper");
+	compiler.Compile(file, "greet.o", {});
+	EXPECT_NE(arguments.find("-fmodule-mapper=mapper"), std::string::npos);
+
+	result = false;
+	EXPECT_THROW(compiler.CompileModule(file, "greet.o", {}), sys::exceptions::CompilationErrorException);
+
+	result = true;
 }
 
 /**
@@ -67,6 +146,60 @@ TEST(GNUPlusPlusTest, TestGetDependencies)
 	sys::tools::compilers::GNUPlusPlus compiler{"", std::vector<std::filesystem::path>{}};
 
 	const std::filesystem::path file{"main.cpp"};
-	const auto dependencies = compiler.GetDependencies(file);
+	const auto dependencies = compiler.GetDependencies(file, {});
 	EXPECT_EQ(dependencies.at(0), std::filesystem::path{"c.cpp"});
+}
+
+/**
+ * @brief Check if the GetDependencies() method skips the line continuations of long rules
+ * 
+ */
+TEST(GNUPlusPlusTest, TestGetDependenciesMultipleLines)
+{
+	output = "main.o: main.cpp a.hpp \\\n b.hpp\n";
+
+	sys::tools::compilers::GNUPlusPlus compiler{"", std::vector<std::filesystem::path>{}};
+
+	const std::filesystem::path file{"main.cpp"};
+	const auto dependencies = compiler.GetDependencies(file, {});
+	ASSERT_EQ(dependencies.size(), 2);
+	EXPECT_EQ(dependencies.at(0), std::filesystem::path{"a.hpp"});
+	EXPECT_EQ(dependencies.at(1), std::filesystem::path{"b.hpp"});
+}
+
+/**
+ * @brief Check if the Preprocess() method returns the output of the compiler
+ * 
+ */
+TEST(GNUPlusPlusTest, TestPreprocess)
+{
+	output = "int main() {}";
+
+	sys::tools::compilers::GNUPlusPlus compiler{"", std::vector<std::filesystem::path>{}};
+	EXPECT_EQ(compiler.Preprocess("main.cpp", {}), output);
+	EXPECT_NE(arguments.find("-E"), std::string::npos);
+}
+
+/**
+ * @brief Check if the Link() method reports a failure, if the system command returns false
+ * 
+ */
+TEST(GNUPlusPlusTest, TestLinkFail)
+{
+	sys::tools::compilers::GNUPlusPlus compiler{"", std::vector<std::filesystem::path>{}};
+
+	result = false;
+	EXPECT_FALSE(compiler.Link({std::filesystem::path{"main.o"}}, std::filesystem::path{"main"}, {}));
+
+	result = true;
+}
+
+/**
+ * @brief Check if the Link() method reports a success, if the system command returns true
+ * 
+ */
+TEST(GNUPlusPlusTest, TestLinkSuccess)
+{
+	sys::tools::compilers::GNUPlusPlus compiler{"", std::vector<std::filesystem::path>{}};
+	EXPECT_TRUE(compiler.Link({std::filesystem::path{"main.o"}}, std::filesystem::path{"main"}, {}));
 }
\ No newline at end of file
@@ -21,6 +21,8 @@
 
 bool result{true};
 std::string output{};
+std::string errors{};
+std::string arguments{};
 
 namespace sys::nix
 {
@@ -31,11 +33,16 @@ Command::Command(std::string line)
 
 Command::Command(std::string program, std::string parameters)
 {
-	// noop
+	arguments = std::move(parameters);
 }
 
 bool Command::Execute()
 {
+	if(listener_ && !errors.empty())
+	{
+		listener_(errors);
+	}
+
 	return result;
 }
 
@@ -43,4 +50,19 @@ std::string Command::GetOutput() const
 {
 	return output;
 }
+
+void Command::SetListener(Listener listener)
+{
+	listener_ = std::move(listener);
+}
+
+void Command::SetDirectory(std::filesystem::path directory)
+{
+	directory_ = std::move(directory);
+}
+
+Usage Command::GetUsage() const
+{
+	return {};
+}
 } // namespace sys::nix
\ No newline at end of file
@@ -0,0 +1,177 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "fakes/sys/walker.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief A text fixture to test sys::Walker component
+ * 
+ */
+class WalkerTest : public ::testing::Test
+{
+protected:
+	/**
+	 * @brief Create the directory tree, walked by the test suite
+	 * 
+	 */
+	void SetUp() override
+	{
+		for(const auto& file : {"src/b.cpp", "src/a.cpp", "src/a.hpp", "src/sub/c.cpp", ".hidden/d.cpp"})
+		{
+			CreateFile(file);
+		}
+	}
+
+	/**
+	 * @brief Remove the files created by the test
+	 * 
+	 */
+	void TearDown() override
+	{
+		fs::remove_all(kDirectory);
+		fs::remove(kCachePath);
+	}
+
+	/**
+	 * @brief Create an empty file in the directory tree
+	 * 
+	 * @param file - the path to the file, relative to the tree
+	 */
+	void CreateFile(const fs::path& file)
+	{
+		fs::create_directories((kDirectory / file).parent_path());
+		std::ofstream stream{kDirectory / file};
+	}
+
+protected:
+	/**
+	 * @brief The directory tree, used by the test suite
+	 * 
+	 */
+	static const fs::path kDirectory;
+
+	/**
+	 * @brief The file the listings are cached in
+	 * 
+	 */
+	static const fs::path kCachePath;
+
+	/**
+	 * @brief The instance to test
+	 * 
+	 */
+	fakes::sys::Walker instance_{kCachePath, 2};
+};
+
+const fs::path WalkerTest::kDirectory{"tree"};
+const fs::path WalkerTest::kCachePath{"listings.bin"};
+
+/**
+ * @brief Check if the wildcards match the files of a single directory only
+ * 
+ */
+TEST_F(WalkerTest, TestGlob)
+{
+	const std::vector<fs::path> expected{"src/a.cpp", "src/b.cpp"};
+	EXPECT_EQ(instance_.Glob(kDirectory, "src/*.cpp"), expected);
+}
+
+/**
+ * @brief Check if "**" matches files in any visible directory
+ * 
+ */
+TEST_F(WalkerTest, TestGlobRecursive)
+{
+	const std::vector<fs::path> expected{"src/a.cpp", "src/b.cpp", "src/sub/c.cpp"};
+	EXPECT_EQ(instance_.Glob(kDirectory, "**/*.cpp"), expected);
+}
+
+/**
+ * @brief Check if the files added after a directory was listed are found
+ * 
+ */
+TEST_F(WalkerTest, TestGlobModified)
+{
+	EXPECT_EQ(instance_.Glob(kDirectory, "src/sub/*.cpp").size(), 1);
+
+	CreateFile("src/sub/e.cpp");
+	const std::vector<fs::path> expected{"src/sub/c.cpp", "src/sub/e.cpp"};
+	EXPECT_EQ(instance_.Glob(kDirectory, "src/sub/*.cpp"), expected);
+}
+
+/**
+ * @brief Check if the concurrent calls only wait for their own listings, and get their own files
+ * 
+ */
+TEST_F(WalkerTest, TestGlobConcurrent)
+{
+	std::vector<std::vector<fs::path>> results(8);
+	std::vector<std::thread> threads{};
+	for(std::size_t index = 0; index < results.size(); ++index)
+	{
+		threads.emplace_back([this, &results, index] {
+			results[index] = instance_.Glob(kDirectory, index % 2 ? "**/*.cpp" : "src/*.hpp");
+		});
+	}
+
+	for(auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	for(std::size_t index = 0; index < results.size(); ++index)
+	{
+		EXPECT_EQ(results[index].size(), index % 2 ? 3 : 1);
+	}
+}
+
+/**
+ * @brief Check if the saved listings are loaded by another instance
+ * 
+ */
+TEST_F(WalkerTest, TestSave)
+{
+	instance_.Glob(kDirectory, "**/*.cpp");
+	instance_.Save();
+
+	fakes::sys::Walker walker{kCachePath, 1};
+	EXPECT_EQ(walker.listings_.size(), instance_.listings_.size());
+	EXPECT_EQ(walker.Glob(kDirectory, "**/*.cpp"), instance_.Glob(kDirectory, "**/*.cpp"));
+}
+
+/**
+ * @brief Check if the IsPattern() method detects the wildcards
+ * 
+ */
+TEST_F(WalkerTest, TestIsPattern)
+{
+	EXPECT_TRUE(sys::Walker::IsPattern("src/*.cpp"));
+	EXPECT_TRUE(sys::Walker::IsPattern("file?.cpp"));
+	EXPECT_TRUE(sys::Walker::IsPattern("[ab].cpp"));
+	EXPECT_FALSE(sys::Walker::IsPattern("src/main.cpp"));
+}
\ No newline at end of file
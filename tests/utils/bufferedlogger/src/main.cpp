@@ -156,4 +156,48 @@ TEST_F(BufferedLoggerTest, TestStreamOperatorFunctionEnd)
 	// Check if the End() flushes the buffer
 	EXPECT_EQ(object_.buffer_log_level_, fakes::utils::BufferedLogger::LogLevel::kInfo);
 	EXPECT_TRUE(object_.buffer_.empty());
+}
+
+/**
+ * @fn BufferedLoggerTest.TestStreamOperatorDisabledLevel
+ * @brief Check if nothing is buffered for the level below the minimum one
+ * 
+ */
+TEST_F(BufferedLoggerTest, TestStreamOperatorDisabledLevel)
+{
+	using LogLevel = fakes::utils::BufferedLogger::LogLevel;
+
+	fakes::utils::BufferedLogger::minimum_log_level_ = LogLevel::kError;
+	object_ << LogLevel::kDebug << "Hello world!" << 5;
+	const auto buffer = object_.buffer_;
+	fakes::utils::BufferedLogger::minimum_log_level_ = LogLevel::kDebug;
+
+	EXPECT_TRUE(buffer.empty());
+}
+
+/**
+ * @fn BufferedLoggerTest.TestWrite
+ * @brief Check if the function is only called for the enabled levels and the message is flushed
+ * 
+ */
+TEST_F(BufferedLoggerTest, TestWrite)
+{
+	using LogLevel = fakes::utils::BufferedLogger::LogLevel;
+
+	bool called{false};
+	object_.Write<LogLevel::kError>([&called](auto& logger) {
+		called = true;
+		logger << "Hello world!";
+	});
+
+	EXPECT_TRUE(called);
+	EXPECT_TRUE(object_.buffer_.empty());
+	EXPECT_EQ(object_.buffer_log_level_, LogLevel::kInfo);
+
+	called = false;
+	fakes::utils::BufferedLogger::minimum_log_level_ = LogLevel::kFatal;
+	object_.Write<LogLevel::kError>([&called](auto&) { called = true; });
+	fakes::utils::BufferedLogger::minimum_log_level_ = LogLevel::kDebug;
+
+	EXPECT_FALSE(called);
 }
\ No newline at end of file
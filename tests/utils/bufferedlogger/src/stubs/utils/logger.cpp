@@ -25,7 +25,7 @@ std::ofstream Logger::stream_{};
 std::mutex Logger::mutex_;
 Logger::LogLevel Logger::minimum_log_level_{};
 
-void Logger::SetFile(std::string_view file) {}
+void Logger::SetFile(std::string_view file, Sink sink) {}
 
 void Logger::SetMinimumLogLevel(LogLevel level) noexcept {}
 
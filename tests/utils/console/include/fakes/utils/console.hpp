@@ -0,0 +1,38 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include "utils/console.hpp"
+
+namespace fakes::utils
+{
+/**
+ * @brief The class is used to fake the Console and give access to it's protected fields
+ * 
+ */
+class Console : public ::utils::Console
+{
+public:
+	using ::utils::Console::blocks_;
+	using ::utils::Console::focus_;
+	using ::utils::Console::stream_;
+	using ::utils::Console::writer_;
+};
+} // namespace fakes::utils
\ No newline at end of file
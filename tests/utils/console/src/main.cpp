@@ -0,0 +1,154 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fakes/utils/console.hpp"
+
+/**
+ * @brief Test fixture class for the Console component testing
+ * 
+ */
+class ConsoleTest : public ::testing::Test
+{
+protected:
+	/**
+	 * @brief Print the output into a temporary file
+	 * 
+	 */
+	void SetUp() override
+	{
+		stream_ = std::tmpfile();
+		ASSERT_NE(stream_, nullptr);
+		fakes::utils::Console::SetStream(stream_);
+	}
+
+	/**
+	 * @brief Stop the writer and close the temporary file
+	 * 
+	 */
+	void TearDown() override
+	{
+		fakes::utils::Console::Close();
+		fakes::utils::Console::SetStream(stderr);
+		fakes::utils::Console::SetFocus("");
+		std::fclose(stream_);
+	}
+
+	/**
+	 * @brief Get everything that was printed
+	 * 
+	 * @return std::string - the printed text
+	 */
+	std::string GetPrinted()
+	{
+		fakes::utils::Console::Flush();
+
+		std::string result(static_cast<std::size_t>(std::ftell(stream_)), '\0');
+		std::rewind(stream_);
+		result.resize(std::fread(result.data(), 1, result.size(), stream_));
+		return result;
+	}
+
+protected:
+	std::FILE* stream_;
+};
+
+/**
+ * @fn ConsoleTest.TestWrite
+ * @brief Check if the blocks are printed in the order they were written
+ * 
+ */
+TEST_F(ConsoleTest, TestWrite)
+{
+	fakes::utils::Console::Write("First\n");
+	fakes::utils::Console::Write("Second\n");
+
+	EXPECT_EQ(GetPrinted(), "First\nSecond\n");
+	EXPECT_TRUE(fakes::utils::Console::blocks_.empty());
+}
+
+/**
+ * @fn ConsoleTest.TestClose
+ * @brief Check if the blocks, left in the queue, are printed when the console is closed
+ * 
+ */
+TEST_F(ConsoleTest, TestClose)
+{
+	fakes::utils::Console::Write("Block\n");
+	fakes::utils::Console::Close();
+
+	EXPECT_FALSE(fakes::utils::Console::writer_.joinable());
+	EXPECT_EQ(GetPrinted(), "Block\n");
+}
+
+/**
+ * @fn ConsoleTest.TestWriteConcurrent
+ * @brief Check if the blocks, written by many threads, are never interleaved
+ * 
+ */
+TEST_F(ConsoleTest, TestWriteConcurrent)
+{
+	constexpr std::size_t kThreads = 4;
+	constexpr std::size_t kBlocks  = 100;
+
+	std::vector<std::thread> threads{};
+	for(std::size_t index = 0; index < kThreads; ++index)
+	{
+		threads.emplace_back([index] {
+			const std::string line(16, static_cast<char>('a' + index));
+			for(std::size_t block = 0; block < kBlocks; ++block)
+			{
+				fakes::utils::Console::Write(line + "\n" + line + "\n");
+			}
+		});
+	}
+
+	for(auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	// Every block consists of two equal lines, so the odd lines must repeat the even ones
+	const auto printed = GetPrinted();
+	ASSERT_EQ(printed.size(), kThreads * kBlocks * 2 * 17);
+	for(std::size_t offset = 0; offset < printed.size(); offset += 2 * 17)
+	{
+		EXPECT_EQ(printed.compare(offset, 17, printed, offset + 17, 17), 0);
+	}
+}
+
+/**
+ * @fn ConsoleTest.TestSetFocus
+ * @brief Check if only the job, set with SetFocus(), is focused
+ * 
+ */
+TEST_F(ConsoleTest, TestSetFocus)
+{
+	EXPECT_FALSE(fakes::utils::Console::IsFocused(""));
+
+	fakes::utils::Console::SetFocus("job");
+	EXPECT_EQ(fakes::utils::Console::focus_, "job");
+	EXPECT_TRUE(fakes::utils::Console::IsFocused("job"));
+	EXPECT_FALSE(fakes::utils::Console::IsFocused("other"));
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include "utils/exceptions/invalidlogexception.hpp"
+
+namespace fakes::utils::exceptions
+{
+namespace exc = ::utils::exceptions;
+
+/**
+ * @brief An fake for the exception, used to notify that the binary log is malformed
+ * 
+ */
+class InvalidLogException : public exc::InvalidLogException
+{
+public:
+	/**
+	 * @brief Construct a new InvalidLogException object
+	 * 
+	 * @param offset - the offset of the malformed data
+	 */
+	explicit InvalidLogException(std::size_t offset)
+		: exc::InvalidLogException{offset}
+	{}
+
+public:
+	using exc::InvalidLogException::kMessage;
+};
+} // namespace fakes::utils::exceptions
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include "utils/joboutput.hpp"
+
+namespace fakes::utils
+{
+/**
+ * @brief The class is used to fake the JobOutput and give access to it's protected fields
+ * 
+ */
+class JobOutput : public ::utils::JobOutput
+{
+public:
+	/**
+	 * @brief Construct a new JobOutput object
+	 * 
+	 * @param job_name the name of the job to use
+	 */
+	JobOutput(std::string job_name)
+		: ::utils::JobOutput{job_name}
+	{}
+
+public:
+	using ::utils::JobOutput::buffer_;
+	using ::utils::JobOutput::component_name_;
+	using ::utils::JobOutput::focused_;
+	using ::utils::JobOutput::line_start_;
+};
+} // namespace fakes::utils
\ No newline at end of file
@@ -0,0 +1,171 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fakes/utils/joboutput.hpp"
+
+extern std::vector<std::string> blocks;
+extern std::vector<std::string> entries;
+extern bool focused;
+
+/**
+ * @brief Test fixture class for the JobOutput component testing
+ * 
+ */
+class JobOutputTest : public ::testing::Test
+{
+protected:
+	/**
+	 * @brief Clear everything the previous test has printed and logged
+	 * 
+	 */
+	void SetUp() override
+	{
+		blocks.clear();
+		entries.clear();
+		focused = false;
+	}
+};
+
+/**
+ * @fn JobOutputTest.TestConstructor
+ * @brief Check if the constructor sets the name of the job and checks if it's focused
+ * 
+ */
+TEST_F(JobOutputTest, TestConstructor)
+{
+	focused = true;
+	const fakes::utils::JobOutput object{"job"};
+
+	EXPECT_EQ(object.component_name_, "job");
+	EXPECT_TRUE(object.focused_);
+	EXPECT_TRUE(object.line_start_);
+}
+
+/**
+ * @fn JobOutputTest.TestCapture
+ * @brief Check if the output is kept until the action finishes
+ * 
+ */
+TEST_F(JobOutputTest, TestCapture)
+{
+	fakes::utils::JobOutput object{"job"};
+	object.Capture("first\n");
+	object.Capture("second");
+
+	EXPECT_EQ(object.buffer_, "first\nsecond");
+	EXPECT_TRUE(blocks.empty());
+}
+
+/**
+ * @fn JobOutputTest.TestFlush
+ * @brief Check if the output is printed as one block with every line prefixed, and logged
+ * 
+ */
+TEST_F(JobOutputTest, TestFlush)
+{
+	fakes::utils::JobOutput object{"job"};
+	object.Capture("first\nsec");
+	object.Capture("ond");
+	object.Flush();
+
+	ASSERT_EQ(blocks.size(), 1);
+	EXPECT_EQ(blocks.front(), "[job] first\n[job] second\n");
+	ASSERT_EQ(entries.size(), 1);
+	EXPECT_EQ(entries.front(), "first\nsecond");
+	EXPECT_TRUE(object.buffer_.empty());
+}
+
+/**
+ * @fn JobOutputTest.TestFlushEmpty
+ * @brief Check if nothing is printed or logged, if the action has no output
+ * 
+ */
+TEST_F(JobOutputTest, TestFlushEmpty)
+{
+	fakes::utils::JobOutput object{"job"};
+	object.Capture("");
+	object.Flush();
+
+	EXPECT_TRUE(blocks.empty());
+	EXPECT_TRUE(entries.empty());
+}
+
+/**
+ * @fn JobOutputTest.TestCaptureFocused
+ * @brief Check if the output of the focused job is printed as soon as it's captured
+ * 
+ */
+TEST_F(JobOutputTest, TestCaptureFocused)
+{
+	focused = true;
+	fakes::utils::JobOutput object{"job"};
+	object.Capture("first\nsec");
+	object.Capture("ond\n");
+
+	ASSERT_EQ(blocks.size(), 2);
+	EXPECT_EQ(blocks.at(0), "[job] first\n[job] sec");
+	EXPECT_EQ(blocks.at(1), "ond\n");
+
+	// The output is not printed again, but is still logged
+	object.Flush();
+	EXPECT_EQ(blocks.size(), 2);
+	EXPECT_EQ(entries.size(), 1);
+}
+
+/**
+ * @fn JobOutputTest.TestDestructor
+ * @brief Check if the output is printed, when the action ends without flushing it
+ * 
+ */
+TEST_F(JobOutputTest, TestDestructor)
+{
+	{
+		auto object = fakes::utils::JobOutput::GetInstance("job");
+		object.Capture("error\n");
+	}
+
+	ASSERT_EQ(blocks.size(), 1);
+	EXPECT_EQ(blocks.front(), "[job] error\n");
+}
+
+/**
+ * @fn JobOutputTest.TestMove
+ * @brief Check if the output is printed once, when the moved-from object is destroyed as well
+ * 
+ */
+TEST_F(JobOutputTest, TestMove)
+{
+	{
+		fakes::utils::JobOutput object{"job"};
+		object.Capture("error\n");
+
+		const fakes::utils::JobOutput moved{std::move(object)};
+		EXPECT_TRUE(object.buffer_.empty());
+		EXPECT_EQ(moved.buffer_, "error\n");
+	}
+
+	ASSERT_EQ(blocks.size(), 1);
+	EXPECT_EQ(blocks.front(), "[job] error\n");
+}
\ No newline at end of file
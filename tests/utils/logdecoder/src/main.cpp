@@ -0,0 +1,161 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "utils/binary.hpp"
+#include "utils/logdecoder.hpp"
+
+using utils::LogDecoder;
+using utils::LogFormat;
+using utils::binary::Write;
+
+/**
+ * @brief A text fixture to test utils::LogDecoder component
+ * 
+ */
+class LogDecoderTest : public ::testing::Test
+{
+protected:
+	/**
+	 * @brief Write the log with a single entry
+	 * 
+	 */
+	void SetUp() override
+	{
+		Write(data_, LogDecoder::kMagic);
+		Write(data_, LogDecoder::kVersion);
+
+		Write(data_, LogDecoder::Tag::kFormat);
+		Write(data_, std::uint32_t{1});
+		Write(data_, std::string_view{"Built {} in {} ms"});
+
+		Write(data_, LogDecoder::Tag::kComponent);
+		Write(data_, std::uint32_t{0});
+		Write(data_, std::string_view{"pipeline"});
+
+		std::string arguments{};
+		for(const LogFormat::Argument argument : {LogFormat::Argument{"\"app\""}, LogFormat::Argument{42}})
+		{
+			arguments.append(argument.GetHead()).append(argument.GetTail());
+		}
+
+		Write(data_, LogDecoder::Tag::kEntry);
+		Write(data_, std::int64_t{0});
+		Write(data_, static_cast<std::uint8_t>(utils::Logger::LogLevel::kInfo));
+		Write(data_, std::uint32_t{0});
+		Write(data_, std::uint32_t{1});
+		Write(data_, std::string_view{arguments});
+	}
+
+protected:
+	/**
+	 * @brief The binary log, used by the test suite
+	 * 
+	 */
+	std::string data_;
+};
+
+/**
+ * @brief Check if the entry is decoded as a line of text
+ * 
+ */
+TEST_F(LogDecoderTest, TestDecodeText)
+{
+	std::stringstream stream{};
+	LogDecoder decoder{LogDecoder::Output::kText};
+	decoder.Decode(data_, stream);
+
+	const auto line = stream.str();
+	EXPECT_NE(line.find(" [pipeline] Built \"app\" in 42 ms\n"), std::string::npos);
+}
+
+/**
+ * @brief Check if the entry is decoded as a JSON line
+ * 
+ */
+TEST_F(LogDecoderTest, TestDecodeJson)
+{
+	std::stringstream stream{};
+	LogDecoder decoder{LogDecoder::Output::kJson};
+	decoder.Decode(data_, stream);
+
+	EXPECT_EQ(stream.str(), "{\"time\":0,\"level\":\"info\",\"component\":\"pipeline\","
+							"\"format\":\"Built {} in {} ms\",\"message\":\"Built \\\"app\\\" in 42 ms\","
+							"\"arguments\":[\"\\\"app\\\"\",42]}\n");
+}
+
+/**
+ * @brief Check if the floating-point arguments are decoded as valid JSON numbers without losing the precision
+ * 
+ */
+TEST_F(LogDecoderTest, TestDecodeJsonDouble)
+{
+	std::string arguments{};
+	for(const LogFormat::Argument argument : {LogFormat::Argument{0.1},
+											  LogFormat::Argument{std::numeric_limits<double>::quiet_NaN()},
+											  LogFormat::Argument{std::numeric_limits<double>::infinity()}})
+	{
+		arguments.append(argument.GetHead()).append(argument.GetTail());
+	}
+
+	Write(data_, LogDecoder::Tag::kEntry);
+	Write(data_, std::int64_t{0});
+	Write(data_, static_cast<std::uint8_t>(utils::Logger::LogLevel::kInfo));
+	Write(data_, std::uint32_t{0});
+	Write(data_, std::uint32_t{1});
+	Write(data_, std::string_view{arguments});
+
+	std::stringstream stream{};
+	LogDecoder decoder{LogDecoder::Output::kJson};
+	decoder.Decode(data_, stream);
+
+	EXPECT_NE(stream.str().find("\"arguments\":[0.10000000000000001,null,null]}\n"), std::string::npos);
+}
+
+/**
+ * @brief Check if the log with the wrong signature is rejected
+ * 
+ */
+TEST_F(LogDecoderTest, TestDecodeInvalidMagic)
+{
+	data_[0] = 'X';
+
+	std::stringstream stream{};
+	LogDecoder decoder{LogDecoder::Output::kText};
+	EXPECT_THROW(decoder.Decode(data_, stream), std::runtime_error);
+}
+
+/**
+ * @brief Check if the truncated log is rejected
+ * 
+ */
+TEST_F(LogDecoderTest, TestDecodeTruncated)
+{
+	data_.pop_back();
+
+	std::stringstream stream{};
+	LogDecoder decoder{LogDecoder::Output::kText};
+	EXPECT_THROW(decoder.Decode(data_, stream), std::runtime_error);
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/logformat.hpp"
+
+using utils::LogFormat;
+
+/**
+ * @brief Encode the arguments the way the logger does
+ * 
+ * @param arguments - the arguments to encode
+ * @return std::string - the encoded arguments
+ */
+static std::string Encode(std::initializer_list<LogFormat::Argument> arguments)
+{
+	std::string result{};
+	for(const auto& argument : arguments)
+	{
+		result.append(argument.GetHead()).append(argument.GetTail());
+	}
+
+	return result;
+}
+
+/**
+ * @brief Check if every format gets it's own ID and the plain message is always the first one
+ * 
+ */
+TEST(LogFormatTest, TestConstructor)
+{
+	const LogFormat first{"first {}"};
+	const LogFormat second{"second {}"};
+
+	EXPECT_NE(first.GetId(), LogFormat::kMessage);
+	EXPECT_NE(first.GetId(), second.GetId());
+	EXPECT_EQ(LogFormat::GetFormat(first.GetId()), "first {}");
+	EXPECT_EQ(LogFormat::GetFormat(second.GetId()), "second {}");
+	EXPECT_EQ(LogFormat::GetFormat(LogFormat::kMessage), "{}");
+	EXPECT_TRUE(LogFormat::GetFormat(second.GetId() + 1).empty());
+}
+
+/**
+ * @brief Check if the arguments are decoded with their types
+ * 
+ */
+TEST(LogFormatTest, TestDecode)
+{
+	const std::string text{"text"};
+	const auto arguments = Encode({-1, 2u, 0.5, std::string_view{text}, std::string_view{"literal"}});
+
+	std::vector<LogFormat::Value> values{};
+	ASSERT_TRUE(LogFormat::Decode(arguments, values));
+	ASSERT_EQ(values.size(), 5);
+	EXPECT_EQ(std::get<std::int64_t>(values[0]), -1);
+	EXPECT_EQ(std::get<std::uint64_t>(values[1]), 2);
+	EXPECT_EQ(std::get<double>(values[2]), 0.5);
+	EXPECT_EQ(std::get<std::string_view>(values[3]), text);
+	EXPECT_EQ(std::get<std::string_view>(values[4]), "literal");
+}
+
+/**
+ * @brief Check if the truncated arguments are rejected
+ * 
+ */
+TEST(LogFormatTest, TestDecodeTruncated)
+{
+	const auto arguments = Encode({std::string_view{"text"}});
+
+	std::vector<LogFormat::Value> values{};
+	EXPECT_FALSE(LogFormat::Decode(std::string_view{arguments}.substr(0, arguments.size() - 1), values));
+}
+
+/**
+ * @brief Check if the placeholders are replaced by the values in order
+ * 
+ */
+TEST(LogFormatTest, TestRender)
+{
+	const std::vector<LogFormat::Value> values{std::string_view{"app"}, std::int64_t{42}};
+
+	std::string output{};
+	LogFormat::Render(output, "Built {} in {} ms", values);
+	EXPECT_EQ(output, "Built app in 42 ms");
+
+	output.clear();
+	LogFormat::Render(output, "{} {} {}", values);
+	EXPECT_EQ(output, "app 42 {}");
+}
\ No newline at end of file
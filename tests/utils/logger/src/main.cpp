@@ -18,10 +18,15 @@
  */
 
 #include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "fakes/utils/logger.hpp"
+#include "utils/logdecoder.hpp"
 
 /**
  * @brief Test fixture class for the Logger component testing (only for the functions that deal with the file stream 
@@ -113,6 +118,7 @@ TEST_F(LoggerTestWithFile, TestLogNegativeLowLogLevel)
 	const auto log_level = fakes::utils::Logger::LogLevel::kDebug;
 	const std::string message{"Hello world!"};
 	object_.Log(log_level, message);
+	fakes::utils::Logger::Flush();
 
 	// Check if the log level of the entry is lover that the minimum one
 	EXPECT_LT(log_level, fakes::utils::Logger::minimum_log_level_);
@@ -157,6 +163,7 @@ TEST_F(LoggerTestWithFile, TestLogPositive)
 	const auto log_level = fakes::utils::Logger::LogLevel::kError;
 	const std::string message{"Hello world!"};
 	object_.Log(log_level, message);
+	fakes::utils::Logger::Flush();
 
 	// Expect that the log level is appropriate
 	EXPECT_GE(log_level, fakes::utils::Logger::minimum_log_level_);
@@ -175,4 +182,148 @@ TEST_F(LoggerTestWithFile, TestLogPositive)
 
 	// Close the checker stream
 	checker.close();
+}
+
+/**
+ * @fn LoggerTestWithFile.TestLogConcurrent
+ * @brief Check if the entries of many threads are all written, each on it's own line
+ * 
+ */
+TEST_F(LoggerTestWithFile, TestLogConcurrent)
+{
+	fakes::utils::Logger::SetMinimumLogLevel(fakes::utils::Logger::LogLevel::kDebug);
+
+	// Log more than a buffer of a thread can hold
+	const int threads_count = 4;
+	const int entries_count = 5000;
+	std::vector<std::thread> threads{};
+	for(int index = 0; index < threads_count; ++index)
+	{
+		threads.emplace_back([this] {
+			for(int entry = 0; entry < entries_count; ++entry)
+			{
+				object_.Log(fakes::utils::Logger::LogLevel::kError, "Hello world!");
+			}
+		});
+	}
+
+	for(auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	fakes::utils::Logger::Flush();
+
+	std::ifstream checker(filename_);
+	std::string log_entry;
+	int count = 0;
+	while(std::getline(checker, log_entry))
+	{
+		EXPECT_NE(log_entry.find("[test] Hello world!"), std::string::npos);
+		++count;
+	}
+
+	EXPECT_EQ(count, threads_count * entries_count);
+}
+
+/**
+ * @fn LoggerTestWithFile.TestLogOrder
+ * @brief Check if the entries of different threads are written in the order they were logged
+ * 
+ */
+TEST_F(LoggerTestWithFile, TestLogOrder)
+{
+	// The buffer of this thread is registered before the buffer of the other one
+	object_.Log(fakes::utils::Logger::LogLevel::kError, "first");
+	std::thread{[this] { object_.Log(fakes::utils::Logger::LogLevel::kError, "second"); }}.join();
+	object_.Log(fakes::utils::Logger::LogLevel::kError, "third");
+	fakes::utils::Logger::Flush();
+
+	std::ifstream checker(filename_);
+	std::vector<std::string> entries{};
+	for(std::string log_entry; std::getline(checker, log_entry);)
+	{
+		entries.push_back(log_entry.substr(log_entry.rfind(' ') + 1));
+	}
+
+	EXPECT_EQ(entries, (std::vector<std::string>{"first", "second", "third"}));
+}
+
+/**
+ * @fn LoggerTestWithFile.TestLogFormat
+ * @brief Check if the arguments are substituted into the format of the entry
+ * 
+ */
+TEST_F(LoggerTestWithFile, TestLogFormat)
+{
+	const utils::LogFormat format{"Built {} in {} ms"};
+	object_.Log(fakes::utils::Logger::LogLevel::kError, format, "app", 42);
+	fakes::utils::Logger::Flush();
+
+	std::ifstream checker(filename_);
+	std::string log_entry;
+	std::getline(checker, log_entry);
+	EXPECT_NE(log_entry.find("[test] Built app in 42 ms"), std::string::npos);
+}
+
+/**
+ * @fn LoggerTestWithFile.TestLogBinary
+ * @brief Check if the binary log starts with the signature and defines the format before the entry
+ * 
+ */
+TEST_F(LoggerTestWithFile, TestLogBinary)
+{
+	fakes::utils::Logger::SetFile(filename_, fakes::utils::Logger::Sink::kBinary);
+
+	const utils::LogFormat format{"Linked {}"};
+	object_.Log(fakes::utils::Logger::LogLevel::kError, format, "app");
+	fakes::utils::Logger::Close();
+
+	std::ifstream checker(filename_, std::ios::binary);
+	std::stringstream data{};
+	data << checker.rdbuf();
+	const auto log = data.str();
+
+	std::uint32_t magic{};
+	ASSERT_GE(log.size(), sizeof(magic));
+	std::memcpy(&magic, log.data(), sizeof(magic));
+	EXPECT_EQ(magic, utils::LogDecoder::kMagic);
+	EXPECT_NE(log.find("Linked {}"), std::string::npos);
+	EXPECT_NE(log.find("test"), std::string::npos);
+	EXPECT_LT(log.find("Linked {}"), log.find("app"));
+}
+
+/**
+ * @fn LoggerTest.TestIsCompiled
+ * @brief Check if the levels at and above the compiled one are kept
+ * 
+ */
+TEST(LoggerTest, TestIsCompiled)
+{
+	using LogLevel = fakes::utils::Logger::LogLevel;
+
+	static_assert(fakes::utils::Logger::IsCompiled(LogLevel::kInfo));
+	EXPECT_EQ(fakes::utils::Logger::IsCompiled(LogLevel::kDebug), BBS_LOG_LEVEL == 0);
+}
+
+/**
+ * @fn LoggerTestWithFile.TestLogConstantLevel
+ * @brief Check if the entry of the constant level is filtered by the minimum level at run time
+ * 
+ */
+TEST_F(LoggerTestWithFile, TestLogConstantLevel)
+{
+	using LogLevel = fakes::utils::Logger::LogLevel;
+
+	const utils::LogFormat format{"Entry {}"};
+	fakes::utils::Logger::SetMinimumLogLevel(LogLevel::kError);
+	object_.Log<LogLevel::kWarning>(format, 1);
+	object_.Log<LogLevel::kFatal>(format, 2);
+	fakes::utils::Logger::Flush();
+
+	std::ifstream checker(filename_);
+	std::string log_entry;
+	std::getline(checker, log_entry);
+	EXPECT_NE(log_entry.find("Entry 2"), std::string::npos);
+	EXPECT_FALSE(std::getline(checker, log_entry));
 }
\ No newline at end of file
@@ -0,0 +1,112 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ * 
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/ringbuffer.hpp"
+
+/**
+ * @brief Check if the records are read in the order they were written
+ * 
+ */
+TEST(RingBufferTest, TestReadWrite)
+{
+	utils::RingBuffer buffer{64};
+	EXPECT_TRUE(buffer.Write({"first"}));
+	EXPECT_TRUE(buffer.Write({"sec", "ond"}));
+
+	std::vector<std::string> records{};
+	EXPECT_EQ(buffer.Read([&records](std::string_view record) { records.emplace_back(record); }), 2);
+	EXPECT_EQ(records, (std::vector<std::string>{"first", "second"}));
+	EXPECT_TRUE(buffer.IsEmpty());
+}
+
+/**
+ * @brief Check if the record is rejected when there is no space for it
+ * 
+ */
+TEST(RingBufferTest, TestWriteFull)
+{
+	utils::RingBuffer buffer{16};
+	EXPECT_TRUE(buffer.Write({"12345678"}));
+	EXPECT_FALSE(buffer.Write({"12345678"}));
+	EXPECT_FALSE(buffer.Write({std::string(32, 'x')}));
+
+	buffer.Read([](std::string_view) {});
+	EXPECT_TRUE(buffer.Write({"12345678"}));
+}
+
+/**
+ * @brief Check if the records are kept whole, when they reach the end of the buffer
+ * 
+ */
+TEST(RingBufferTest, TestWrapAround)
+{
+	utils::RingBuffer buffer{32};
+	std::string result{};
+	for(int index = 0; index < 100; ++index)
+	{
+		const auto value = std::to_string(index) + std::string(static_cast<std::size_t>(index % 7), '.');
+		ASSERT_TRUE(buffer.Write({value}));
+		buffer.Read([&result](std::string_view record) { result = record; });
+		EXPECT_EQ(result, value);
+	}
+}
+
+/**
+ * @brief Check if the records, written by one thread, are all read by another one
+ * 
+ */
+TEST(RingBufferTest, TestConcurrent)
+{
+	utils::RingBuffer buffer{256};
+	const int count = 100000;
+
+	std::thread producer{[&buffer] {
+		for(int index = 0; index < count; ++index)
+		{
+			const auto value = std::to_string(index);
+			while(!buffer.Write({value}))
+			{
+				std::this_thread::yield();
+			}
+		}
+	}};
+
+	int expected = 0;
+	while(expected < count)
+	{
+		const auto read = buffer.Read([&expected](std::string_view record) {
+			EXPECT_EQ(record, std::to_string(expected));
+			++expected;
+		});
+
+		if(!read)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	producer.join();
+	EXPECT_TRUE(buffer.IsEmpty());
+}
\ No newline at end of file